@@ -2,11 +2,16 @@
 
 try_compile(CXXITER_HAS_COROUTINE "${CMAKE_CURRENT_BINARY_DIR}/coroutine_test" "${CMAKE_CURRENT_SOURCE_DIR}/cmake/coroutine_test" FeatureTestCoroutine)
 try_compile(CXXITER_HAS_CXX20RANGES "${CMAKE_CURRENT_BINARY_DIR}/cxx20ranges_test" "${CMAKE_CURRENT_SOURCE_DIR}/cmake/cxx20ranges_test" FeatureTestCXX20Ranges)
+try_compile(CXXITER_HAS_MMAP "${CMAKE_CURRENT_BINARY_DIR}/mmap_test" "${CMAKE_CURRENT_SOURCE_DIR}/cmake/mmap_test" FeatureTestMMap)
+try_compile(CXXITER_HAS_POSIX_IO "${CMAKE_CURRENT_BINARY_DIR}/posix_io_test" "${CMAKE_CURRENT_SOURCE_DIR}/cmake/posix_io_test" FeatureTestPosixIO)
 
 set(CXXITER_FEATUREFLAG_NAMES "")
 list(APPEND CXXITER_FEATUREFLAG_NAMES "CXXITER_HAS_COROUTINE")
 list(APPEND CXXITER_FEATUREFLAG_NAMES "CXXITER_HAS_CXX20RANGES")
+list(APPEND CXXITER_FEATUREFLAG_NAMES "CXXITER_HAS_MMAP")
+list(APPEND CXXITER_FEATUREFLAG_NAMES "CXXITER_HAS_POSIX_IO")
 
 set(CXXITER_FEATUREFLAG_COMPILE_DEFINITIONS
 	$<$<BOOL:${CXXITER_HAS_COROUTINE}>:CXXITER_HAS_COROUTINE> $<$<BOOL:${CXXITER_HAS_CXX20RANGES}>:CXXITER_HAS_CXX20RANGES>
+	$<$<BOOL:${CXXITER_HAS_MMAP}>:CXXITER_HAS_MMAP> $<$<BOOL:${CXXITER_HAS_POSIX_IO}>:CXXITER_HAS_POSIX_IO>
 )
@@ -0,0 +1,18 @@
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+int main(int argc, char** argv) {
+	if(argc < 2) { return 0; }
+	int fd = open(argv[1], O_RDONLY | O_CLOEXEC);
+	if(fd < 0) { return 1; }
+	struct stat fileStat;
+	if(fstat(fd, &fileStat) != 0) { return 1; }
+	void* data = mmap(nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if(data == MAP_FAILED) { return 1; }
+	madvise(data, fileStat.st_size, MADV_SEQUENTIAL);
+	munmap(data, fileStat.st_size);
+	return 0;
+}
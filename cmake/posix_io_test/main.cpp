@@ -0,0 +1,13 @@
+#include <fcntl.h>
+#include <unistd.h>
+
+int main(int argc, char** argv) {
+	if(argc < 2) { return 0; }
+	int fd = open(argv[1], O_RDONLY | O_CLOEXEC);
+	if(fd < 0) { return 1; }
+	posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	char buffer[64];
+	ssize_t readCnt = read(fd, buffer, sizeof(buffer));
+	close(fd);
+	return (readCnt < 0);
+}
@@ -6,6 +6,8 @@
 #include <functional>
 #include <string>
 #include <limits>
+#include <variant>
+#include <array>
 
 #include <unordered_map>
 #include <vector>
@@ -13,11 +15,23 @@
 
 #include "src/Common.h"
 #include "src/Generator.h"
+#include "src/AsyncGenerator.h"
 #include "src/sources/Concepts.h"
+#include "src/sources/BitSources.h"
+#include "src/sources/CompressedSources.h"
 #include "src/sources/ContainerSources.h"
 #include "src/sources/GeneratorSources.h"
+#include "src/sources/MappedFileSource.h"
+#include "src/sources/StreamSources.h"
+#include "src/sources/ViewSources.h"
+#include "src/sources/TextSources.h"
 #include "src/Collector.h"
+#include "src/ResumableConsumer.h"
+#include "src/Aggregate.h"
 #include "src/op/Alternater.h"
+#include "src/op/Buffered.h"
+#include "src/op/Cached.h"
+#include "src/op/CachedSorter.h"
 #include "src/op/Caster.h"
 #include "src/op/Chainer.h"
 #include "src/op/Chunked.h"
@@ -28,15 +42,18 @@
 #include "src/op/FlatMap.h"
 #include "src/op/GenerateFrom.h"
 #include "src/op/GroupBy.h"
+#include "src/op/IndirectSorter.h"
 #include "src/op/InplaceModifier.h"
 #include "src/op/Intersperser.h"
 #include "src/op/Map.h"
+#include "src/op/ParMap.h"
 #include "src/op/Reverse.h"
 #include "src/op/SkipN.h"
 #include "src/op/SkipWhile.h"
 #include "src/op/Sorter.h"
 #include "src/op/TakeN.h"
 #include "src/op/TakeWhile.h"
+#include "src/op/Tee.h"
 #include "src/op/Unique.h"
 #include "src/op/Zipper.h"
 #include "src/Helpers.h"
@@ -75,6 +92,15 @@ private:
 	constexpr const TSelf* self() const { return static_cast<const TSelf*>(this); }
 	static constexpr bool IS_REFERENCE = std::is_lvalue_reference_v<Item>;
 
+	/** Amount of items this iterator will yield (if known), or the lower bound of its size hint. */
+	constexpr size_t expectedRemainingSize() const {
+		if constexpr(CXXIterExactSizeIterator<TSelf>) {
+			return trait::ExactSizeIterator<TSelf>::size(*self());
+		} else {
+			return Iterator::sizeHint(*self()).lowerBound;
+		}
+	}
+
 public: // C++ Iterator API-Surface
 
 	/**
@@ -239,12 +265,52 @@ public: // CXXIter API-Surface
 	 */
 	template<typename TUseFn>
 	constexpr void forEach(TUseFn useFn) {
+		if constexpr(CXXIterSegmentedIterator<TSelf>) {
+			// tight loops over each contiguous segment of elements
+			while(true) {
+				auto segment = trait::SegmentedIterator<TSelf>::nextSegment(*self());
+				if(segment.empty()) [[unlikely]] { return; }
+				for(auto& item : segment) { useFn(std::forward<Item>(item)); }
+			}
+		} else {
+			while(true) {
+				auto item = Iterator::next(*self());
+				if(!item.has_value()) [[unlikely]] { return; }
+				useFn(std::forward<Item>( item.value() ));
+			}
+		}
+	}
+
+#ifdef CXXITER_HAS_COROUTINE
+	/**
+	 * @brief Asynchronous consumer that calls the given function @p useFn for each of the elements in this iterator,
+	 * awaiting the CXXIter::Task returned by it, before continuing with the next element.
+	 * @details This allows feeding a (synchronous) iterator pipeline into an asynchronous sink (e.g. a socket),
+	 * without blocking the thread while the sink is busy. This iterator has to outlive the returned task.
+	 * @note This consumes the iterator.
+	 * @param useFn Function called for each of the elements in this iterator, returning a CXXIter::Task<void>.
+	 * @return Task that completes after all elements were consumed.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	CXXIter::EventLoop loop;
+	 * 	std::vector<std::string> input = {"1337", "42", "64"};
+	 * 	auto iter = CXXIter::from(input);
+	 * 	loop.runUntilComplete(iter.forEachAsync([&](const std::string& item) -> CXXIter::Task<> {
+	 * 		co_await socket.send(item);
+	 * 	}));
+	 * @endcode
+	 */
+	template<typename TUseFn>
+	requires util::is_template_instance_v<std::invoke_result_t<TUseFn&, Item>, Task>
+	Task<void> forEachAsync(TUseFn useFn) {
 		while(true) {
 			auto item = Iterator::next(*self());
-			if(!item.has_value()) [[unlikely]] { return; }
-			useFn(std::forward<Item>( item.value() ));
+			if(!item.has_value()) [[unlikely]] { co_return; }
+			co_await useFn(std::forward<Item>( item.value() ));
 		}
 	}
+#endif
 
 	/**
 	 * @brief Consumer that collects all elements from this iterator in a new container of type @p TTargetContainer
@@ -330,6 +396,112 @@ public: // CXXIter API-Surface
 		IntoCollector<TSelf, TTargetContainer>::collectInto(*self(), container);
 	}
 
+	/**
+	 * @brief Consumer that splits the pair- or tuple-elements of this iterator into their fields, and collects
+	 * each field into the corresponding one of the given @p containers - in a single traversal.
+	 * @note This consumes the iterator.
+	 * @details This is the single-pass alternative to building the iterator chain multiple times and
+	 * collecting every field separately using @c map(CXXIter::fn::unzip<IDX>()). It thus also works
+	 * for sources that can not be iterated multiple times, such as @c fromFn() or @c generate().
+	 * Before collecting, all containers are reserved for the exact amount of items if this iterator's
+	 * size is known, or for the lower bound of its size hint otherwise.
+	 * @param containers Containers to collect the fields of this iterator's elements into. There has to be
+	 * exactly one container per field of the element type. The items are appended to the items already
+	 * present in the containers.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<std::pair<std::string, int>> input = {{"1337", 1337}, {"42", 42}};
+	 * 	std::vector<std::string> outputKeys;
+	 * 	std::vector<int> outputValues;
+	 * 	CXXIter::from(input).unzipInto(outputKeys, outputValues);
+	 * 	// outputKeys == {"1337", "42"}
+	 * 	// outputValues == {1337, 42}
+	 * @endcode
+	 */
+	template<typename... TTargetContainers>
+	requires (std::tuple_size_v<ItemOwned> == sizeof...(TTargetContainers))
+	constexpr void unzipInto(TTargetContainers&... containers) {
+		const size_t expectedSize = expectedRemainingSize();
+		(reserveAdditional(containers, expectedSize), ...);
+		forEach([&containers...](Item&& item) {
+			[&]<size_t... IDX>(std::index_sequence<IDX...>) {
+				(collectItemInto(containers, std::get<IDX>(std::forward<Item>(item))), ...);
+			}(std::index_sequence_for<TTargetContainers...>{});
+		});
+	}
+
+	/**
+	 * @brief Consumer that splits the elements of this iterator into two containers of type @p TTargetContainer
+	 * in a single traversal. The first container receives all elements for which the given @p predicateFn
+	 * returned @c true, the second all other elements.
+	 * @note This consumes the iterator.
+	 * @details This is the single-pass alternative to building the iterator chain twice with two opposing
+	 * @c filter() calls. The relative order of the elements is preserved in both containers.
+	 * @tparam TTargetContainer Type-Template for the target containers that the elements should be collected into.
+	 * @param predicateFn Predicate deciding in which of the two containers an element is collected.
+	 * @return A @c std::pair with the container of the matching elements in the first, and the container
+	 * of the remaining elements in the second slot.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<int> input = {1, 2, 3, 4, 5, 6, 7};
+	 * 	auto [even, odd] = CXXIter::from(input)
+	 * 		.partition([](int item) { return (item % 2) == 0; });
+	 * 	// even == {2, 4, 6}
+	 * 	// odd == {1, 3, 5, 7}
+	 * @endcode
+	 */
+	template<template <typename...> typename TTargetContainer = std::vector, std::invocable<const ItemOwned&> TPredicateFn>
+	requires util::BackInsertableContainerTemplate<TTargetContainer, ItemOwned>
+		|| util::InsertableContainerTemplate<TTargetContainer, ItemOwned>
+	constexpr std::pair<TTargetContainer<ItemOwned>, TTargetContainer<ItemOwned>> partition(TPredicateFn predicateFn) {
+		std::pair<TTargetContainer<ItemOwned>, TTargetContainer<ItemOwned>> result;
+		forEach([&result, &predicateFn](Item&& item) {
+			if(predicateFn(item)) {
+				collectItemInto(result.first, std::forward<Item>(item));
+			} else {
+				collectItemInto(result.second, std::forward<Item>(item));
+			}
+		});
+		return result;
+	}
+
+	/**
+	 * @brief Consumer that splits the elements of this iterator into @p partitionCnt containers of type
+	 * @p TTargetContainer in a single traversal. The container an element is collected into is decided by the
+	 * index returned by the given @p partitionIdxFn.
+	 * @note This consumes the iterator.
+	 * @details The relative order of the elements is preserved within each of the partitions.
+	 * @tparam TTargetContainer Type-Template for the target containers that the elements should be collected into.
+	 * @param partitionIdxFn Function that returns the index of the partition (in the range [0, @p partitionCnt))
+	 * the given element should be collected into.
+	 * @param partitionCnt Amount of partitions to split the elements of this iterator into.
+	 * @return A @c std::vector with @p partitionCnt containers, each containing the elements for which
+	 * @p partitionIdxFn returned the corresponding index.
+	 * @throws std::out_of_range if @p partitionIdxFn returns an index outside of [0, @p partitionCnt).
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<int> input = {1, 2, 3, 4, 5, 6, 7};
+	 * 	std::vector<std::vector<int>> output = CXXIter::from(input)
+	 * 		.partitionBy([](int item) -> size_t { return (item % 3); }, 3);
+	 * 	// output == { {3, 6}, {1, 4, 7}, {2, 5} }
+	 * @endcode
+	 */
+	template<template <typename...> typename TTargetContainer = std::vector, std::invocable<const ItemOwned&> TPartitionIdxFn>
+	requires std::convertible_to<std::invoke_result_t<TPartitionIdxFn, const ItemOwned&>, size_t>
+		&& (util::BackInsertableContainerTemplate<TTargetContainer, ItemOwned>
+			|| util::InsertableContainerTemplate<TTargetContainer, ItemOwned>)
+	constexpr std::vector<TTargetContainer<ItemOwned>> partitionBy(TPartitionIdxFn partitionIdxFn, size_t partitionCnt) {
+		std::vector<TTargetContainer<ItemOwned>> result(partitionCnt);
+		forEach([&result, &partitionIdxFn](Item&& item) {
+			const size_t partitionIdx = static_cast<size_t>(partitionIdxFn(item));
+			collectItemInto(result.at(partitionIdx), std::forward<Item>(item));
+		});
+		return result;
+	}
+
 	/**
 	 * @brief Consumer that executes the given @p foldFn for each item in this iterator, to apply
 	 * to a working value, which is passed on and passed as second argument to the next call to @p foldFn.
@@ -356,6 +528,177 @@ public: // CXXIter API-Surface
 		return result;
 	}
 
+	/**
+	 * @brief Resumable variant of forEach(), that consumes the elements in steps of limited size or time.
+	 * @details The returned CXXIter::ResumableConsumer takes ownership of this iterator. Nothing is consumed
+	 * until CXXIter::ResumableConsumer::step() or CXXIter::ResumableConsumer::stepFor() is called.
+	 * @note This consumes the iterator.
+	 * @param useFn Function called for each of the elements in this iterator.
+	 * @return CXXIter::ResumableConsumer, that calls @p useFn for each of the elements in this iterator.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<int> output;
+	 * 	auto consumer = CXXIter::range(0, 9).resumableForEach([&](int item) { output.push_back(item); });
+	 * 	consumer.step(4);
+	 * 	// output == {0, 1, 2, 3}
+	 * 	consumer.step(10);
+	 * 	// output == {0, 1, 2, 3, 4, 5, 6, 7, 8, 9}
+	 * @endcode
+	 */
+	template<typename TUseFn>
+	auto resumableForEach(TUseFn useFn) {
+		auto consumeFn = [useFn](std::monostate&, Item&& item) mutable { useFn(std::forward<Item>(item)); };
+		return ResumableConsumer<TSelf, std::monostate, decltype(consumeFn)>(std::move(*self()), std::monostate(), consumeFn);
+	}
+
+	/**
+	 * @brief Resumable variant of fold(), that consumes the elements in steps of limited size or time.
+	 * @details The returned CXXIter::ResumableConsumer takes ownership of this iterator, and keeps the working value
+	 * between steps. It is available using CXXIter::ResumableConsumer::result().
+	 * @note This consumes the iterator.
+	 * @param startValue The initial value of the working value passed to @p foldFn.
+	 * @param foldFn Function called for each element in this iterator, passed the current workingValue and
+	 * an element from this iterator.
+	 * @return CXXIter::ResumableConsumer, whose result is the working value.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	auto consumer = CXXIter::range(1, 100).resumableFold(0, [](int& sum, int item) { sum += item; });
+	 * 	while(!consumer.stepFor(std::chrono::microseconds(100))) {
+	 * 		// handle other work in between
+	 * 	}
+	 * 	// consumer.result() == 5050
+	 * @endcode
+	 */
+	template<typename TResult, std::invocable<TResult&, Item&&> FoldFn>
+	auto resumableFold(TResult startValue, FoldFn foldFn) {
+		return ResumableConsumer<TSelf, TResult, FoldFn>(std::move(*self()), std::move(startValue), foldFn);
+	}
+
+	/**
+	 * @brief Resumable variant of collect(), that consumes the elements in steps of limited size or time.
+	 * @details The returned CXXIter::ResumableConsumer takes ownership of this iterator, and keeps the container
+	 * that is collected into between steps. It is available using CXXIter::ResumableConsumer::result().
+	 * @note This consumes the iterator.
+	 * @tparam TTargetContainer Type-Template for the target container that the elements from this iterator should
+	 * be collected into. This has to support either @c push_back() or @c insert().
+	 * @tparam TTargetContainerArgs... Optional template parameters that are passed to the target container template.
+	 * @return CXXIter::ResumableConsumer, whose result is the container collected into.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	auto consumer = CXXIter::range(0, 9).resumableCollect<std::vector>();
+	 * 	consumer.step(4);
+	 * 	// consumer.result() == {0, 1, 2, 3}
+	 * @endcode
+	 */
+	template<template <typename...> typename TTargetContainer, typename... TTargetContainerArgs>
+	requires util::BackInsertableContainerTemplate<TTargetContainer, ItemOwned, TTargetContainerArgs...>
+		|| util::InsertableContainerTemplate<TTargetContainer, ItemOwned, TTargetContainerArgs...>
+	auto resumableCollect() {
+		using TContainer = TTargetContainer<ItemOwned, TTargetContainerArgs...>;
+		TContainer container;
+		reserveAdditional(container, sizeHint().expectedResultSize());
+		auto consumeFn = [](TContainer& container, Item&& item) { collectItemInto(container, std::forward<Item>(item)); };
+		return ResumableConsumer<TSelf, TContainer, decltype(consumeFn)>(std::move(*self()), std::move(container), consumeFn);
+	}
+
+	/**
+	 * @brief Consumer that sends all elements of this iterator into the given @p channel.
+	 * @details This blocks while the channel is full, and stops early when the channel is closed. The channel is
+	 * not closed by this method, which allows multiple iterators (e.g. on different threads) to send into the same
+	 * channel - see CXXIter::fromChannel() to receive from it.
+	 * @note This consumes the iterator.
+	 * @param channel Channel to send the elements of this iterator into.
+	 * @return Amount of elements that were sent into the @p channel.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	CXXIter::Channel<std::string> channel(16);
+	 * 	std::vector<std::string> input = {"1337", "42"};
+	 * 	size_t sent = CXXIter::from(input).sendTo(channel);
+	 * 	channel.close();
+	 * 	std::vector<std::string> output = CXXIter::fromChannel(channel).collect<std::vector>();
+	 * 	// sent == 2
+	 * 	// output == {"1337", "42"}
+	 * @endcode
+	 */
+	size_t sendTo(Channel<ItemOwned>& channel) {
+		size_t cnt = 0;
+		while(true) {
+			auto item = Iterator::next(*self());
+			if(!item.has_value()) [[unlikely]] { return cnt; }
+			if(!channel.send(std::forward<Item>(item.value()))) [[unlikely]] { return cnt; }
+			++cnt;
+		}
+	}
+
+	/**
+	 * @brief Consumer that pushes each element of this iterator into all of the given @p consumerFns, within one
+	 * single traversal.
+	 * @details This is the single-threaded counterpart of tee(): The consumers are called one after the other for
+	 * each element, so no element has to be buffered or copied. The consumers are returned after the traversal, which
+	 * allows stateful consumers to be queried for their results.
+	 * @note This consumes the iterator.
+	 * @param consumerFns Functions called with a const reference to each of the elements in this iterator.
+	 * @return A @c std::tuple with the given @p consumerFns, after they were called for all elements.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<int> input = {1, 3, 2, 5, 4};
+	 * 	std::vector<int> evens;
+	 * 	int sum = 0;
+	 * 	CXXIter::from(input).broadcast(
+	 * 		[&evens](int item) { if(item % 2 == 0) { evens.push_back(item); } },
+	 * 		[&sum](int item) { sum += item; }
+	 * 	);
+	 * 	// evens == {2, 4}
+	 * 	// sum == 15
+	 * @endcode
+	 */
+	template<typename... TConsumerFns>
+	requires (sizeof...(TConsumerFns) > 0) && (std::invocable<TConsumerFns&, const ItemOwned&> && ...)
+	constexpr std::tuple<TConsumerFns...> broadcast(TConsumerFns... consumerFns) {
+		forEach([&consumerFns...](Item&& item) {
+			const ItemOwned& itemRef = item;
+			(consumerFns(itemRef), ...);
+		});
+		return std::tuple<TConsumerFns...>(std::move(consumerFns)...);
+	}
+
+	/**
+	 * @brief Consumer that runs all of the given @p aggregators on the elements of this iterator,
+	 * within one single traversal.
+	 * @details The aggregators are combined at compile-time, such that every element is passed
+	 * through all of them in the same loop iteration. Available aggregators can be found in the
+	 * CXXIter::agg namespace.
+	 * @note This consumes the iterator.
+	 * @param aggregators Aggregators to run on the elements of this iterator.
+	 * @return A @c std::tuple with the result of each of the given @p aggregators, in the same order.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<int> input = {1, 3, 2, 5, 4};
+	 * 	auto [cnt, sum, max] = CXXIter::from(input)
+	 * 		.aggregate(CXXIter::agg::count(), CXXIter::agg::sum(), CXXIter::agg::max());
+	 * 	// cnt == 5
+	 * 	// sum == 15
+	 * 	// max.value() == 5
+	 * @endcode
+	 */
+	template<typename... TAggregators>
+	requires (sizeof...(TAggregators) > 0) && (agg::Aggregator<TAggregators, Item> && ...)
+	constexpr auto aggregate(TAggregators... aggregators) {
+		auto states = std::make_tuple(aggregators.template init<Item>()...);
+		forEach([&states](Item&& item) {
+			std::apply([&item](auto&... state) { (state.add(item), ...); }, states);
+		});
+		return std::apply([](auto&... state) {
+			return std::tuple<decltype(state.finish())...>(state.finish()...);
+		}, states);
+	}
+
 	/**
 	 * @brief Tests if all elements of this iterator match the given @p predicateFn.
 	 * @note This consumes the iterator.
@@ -1037,7 +1380,7 @@ public: // CXXIter API-Surface
 			auto itemValue = compValueExtractFn(std::forward<Item>(item));
 			if(itemValue < resultValue) {
 				result = item;
-				resultValue = itemValue;
+				resultValue = std::move(itemValue);
 			}
 		});
 		return result;
@@ -1127,7 +1470,7 @@ public: // CXXIter API-Surface
 			auto itemValue = compValueExtractFn(std::forward<Item>(item));
 			if(itemValue > resultValue) {
 				result = item;
-				resultValue = itemValue;
+				resultValue = std::move(itemValue);
 			}
 		});
 		return result;
@@ -1282,6 +1625,97 @@ public: // CXXIter API-Surface
 
 	}
 
+	/**
+	 * @brief Constructs a new iterator that runs this iterator (all stages up to here) on a background thread,
+	 * buffering up to @p capacity of its elements.
+	 * @details The worker thread is started when the first element is requested, and eagerly pulls elements from
+	 * this iterator into a bounded lock-free single-producer / single-consumer ring buffer. The returned iterator
+	 * just pops them, such that expensive stages before and after this point run concurrently. The worker blocks
+	 * while the buffer is full, and is stopped and joined when the returned iterator is destroyed.
+	 * Exceptions thrown by this iterator on the worker thread are rethrown to the consumer, after all elements
+	 * produced before were consumed.
+	 * Elements that this iterator passes by reference are copied on the worker thread, since the referenced
+	 * elements may be invalidated by advancing this iterator (e.g. records of CXXIter::fromCsv()).
+	 * @note All stages before this point run on a different thread than the stages after it. They must thus not
+	 * share unsynchronized state. Elements that are views by value (e.g. @c std::string_view) are buffered as
+	 * views, so the memory they refer to must not be modified by advancing this iterator.
+	 * @param capacity Maximum amount of elements buffered between the worker thread and the consumer.
+	 * @return A new iterator that runs this iterator on a background thread, passing (owned) elements.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<Record> output = CXXIter::fromFn(readAndDecodeFrame) // slow source
+	 * 		.buffered(1024) // decode on a worker thread, while ...
+	 * 		.map(transformRecord) // ... the expensive transformation runs on this thread
+	 * 		.collect<std::vector>();
+	 * @endcode
+	 */
+	op::Buffered<TSelf> buffered(size_t capacity) requires std::is_constructible_v<ItemOwned, Item&&> {
+		return op::Buffered<TSelf>(std::move(*self()), capacity);
+	}
+
+	/**
+	 * @brief Splits this iterator into @p N iterators, that all yield the elements of this iterator - while
+	 * traversing it (all stages up to here) only once.
+	 * @details The elements pulled from this iterator are kept in a buffer shared by all branches, until every
+	 * branch consumed them. The last branch to consume an element gets it moved, all others receive a copy.
+	 * When @p capacity elements are buffered, the branches that are ahead block until the slowest branch caught up.
+	 * The branches are thus meant to be consumed concurrently (e.g. on different threads, or interleaved). A branch
+	 * that is destroyed no longer holds back the others. If this iterator throws, it is not advanced any further,
+	 * and the exception is rethrown by every branch when it reaches the failed element - after which it ends.
+	 * @note The branches can be consumed on different threads, but this iterator is only run on one thread at a
+	 * time. Consuming one branch after the other on the same thread requires a @p capacity that fits all elements,
+	 * otherwise it blocks forever. For single-threaded use, broadcast() pushes every element into multiple
+	 * consumers without any buffering. Only references are materialized: Elements that are views by value (e.g.
+	 * @c std::string_view) are buffered as views, whose memory has to outlive the buffer.
+	 * @tparam N Amount of iterators to split this iterator into.
+	 * @param capacity Maximum amount of elements buffered between the fastest and the slowest branch.
+	 * @return A @c std::array of @p N iterators that each yield (owned) copies of this iterator's elements.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	auto [recordsA, recordsB] = CXXIter::fromMappedFile(path).filterMap(parseRecord).tee<2>(4096);
+	 * 	std::thread aggregateThread([&recordsA]() { totalSize = recordsA.map(&Record::size).sum(); });
+	 * 	std::vector<Record> errors = recordsB.filter(&Record::isError).collect<std::vector>();
+	 * 	aggregateThread.join();
+	 * @endcode
+	 */
+	template<size_t N>
+	requires (N > 0) && std::is_constructible_v<ItemOwned, Item&&> && std::is_copy_constructible_v<ItemOwned>
+	std::array<op::TeeBranch<TSelf>, N> tee(size_t capacity = 1024) {
+		auto state = std::make_shared<op::TeeState<TSelf>>(std::move(*self()), N, capacity);
+		return [&state]<size_t... IDX>(std::index_sequence<IDX...>) {
+			return std::array<op::TeeBranch<TSelf>, N> { ((void)IDX, op::TeeBranch<TSelf>(state))... };
+		}(std::make_index_sequence<N>{});
+	}
+
+	/**
+	 * @brief Constructs a handle that records the elements of this iterator (all stages up to here) while
+	 * traversing it, such that they can be replayed afterwards - without running this iterator again.
+	 * @details The returned handle is no iterator itself, but hands out iterators over the shared recording:
+	 * op::Cached::iter() lazily pulls the elements from this iterator and records them into a @c std::vector,
+	 * starting from the first element (and taking the already recorded ones from the recording). A consumer that
+	 * stops early thus only computes the consumed prefix. op::Cached::replay() hands out cheap exact-size,
+	 * double-ended and contiguous iterators over the recording, that pass const references to the recorded elements.
+	 * Elements that were not yet produced are computed by the first call to op::Cached::replay().
+	 * @note Unlike collect(), this does not traverse the iterator until the elements are requested. The handle and its
+	 * iterators share the recording, and must thus not be used from different threads concurrently.
+	 * Like with collect(), elements that are views by value (e.g. @c std::string_view) are recorded as views - so
+	 * the memory they refer to has to outlive the recording.
+	 * @return A new handle to the recording of this iterator's elements.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	auto records = CXXIter::fromMappedFile(path).filterMap(parseRecord).cached();
+	 * 	CXXIter::IterValue<Record> firstError = records.iter().find([](const Record& r) { return r.isError(); }); // only parses until the first error
+	 * 	size_t totalSize = records.replay().map([](const Record& r) { return r.size(); }).sum(); // parses the rest, once
+	 * 	size_t errorCnt = records.replay().filter([](const Record& r) { return r.isError(); }).count(); // no parsing
+	 * @endcode
+	 */
+	op::Cached<TSelf> cached() requires std::is_copy_constructible_v<ItemOwned> {
+		return op::Cached<TSelf>(std::move(*self()));
+	}
+
 	/**
 	 * @brief Constructs a new iterator that tags each element of this iterator with the corresponding index,
 	 * stored in a @c std::pair.
@@ -1587,6 +2021,69 @@ public: // CXXIter API-Surface
 		return op::Map<TSelf, TMapFn, TMapFnResult>(std::move(*self()), mapFn);
 	}
 
+	/**
+	 * @brief Creates an iterator that works like map(), but evaluates the given @p mapFn on @p threadCnt
+	 * worker threads, while preserving the order of the elements.
+	 * @details The elements are pulled from this iterator on the consuming thread (so this works with any iterator,
+	 * including generators), grouped into batches of @p batchSize elements, and mapped on the worker threads.
+	 * The mapped batches are then passed on in their original order, using a reorder buffer of (at most) two
+	 * batches per worker thread, which bounds the amount of elements that are held in flight.
+	 * The worker threads are started when the first element is requested, and stopped when the returned iterator
+	 * is destroyed. If @p mapFn throws, the exception is rethrown to the consumer after all elements before the
+	 * failed one were passed on - after which the iterator ends.
+	 * Elements that this iterator passes by reference are copied on the consuming thread, since the referenced
+	 * elements may be invalidated by advancing this iterator (e.g. records of CXXIter::fromCsv()). Elements that
+	 * are views by value (e.g. @c std::string_view) are copied as views though, so their memory has to stay valid
+	 * until they were mapped.
+	 * @note @p mapFn is called concurrently from multiple threads, and must thus be thread-safe.
+	 * @param mapFn Function that maps items from this iterator to a new value. Must return an owned value.
+	 * @param threadCnt Amount of worker threads to use.
+	 * @param batchSize Amount of elements that are dispatched to a worker thread at once.
+	 * @return New iterator that maps the values from this iterator to new values in parallel, using the
+	 * given @p mapFn.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<std::string> input = readDocuments();
+	 * 	std::vector<size_t> output = CXXIter::from(input)
+	 * 		.parMap([](const std::string& document) { return expensiveHash(document); }, 8)
+	 * 		.collect<std::vector>();
+	 * 	// output[i] == expensiveHash(input[i])
+	 * @endcode
+	 */
+	template<std::invocable<Item&&> TMapFn>
+	requires (!std::is_reference_v<std::invoke_result_t<const TMapFn&, Item&&>>) && std::is_constructible_v<ItemOwned, Item&&>
+	auto parMap(TMapFn mapFn, size_t threadCnt = std::thread::hardware_concurrency(), size_t batchSize = 64) {
+		using TMapFnResult = std::invoke_result_t<const TMapFn&, Item&&>;
+		return op::ParMap<TSelf, TMapFn, TMapFnResult, true>(std::move(*self()), mapFn, threadCnt, batchSize);
+	}
+
+	/**
+	 * @brief Variant of parMap(), that passes on the mapped batches of elements in order of their completion,
+	 * instead of their original order.
+	 * @details This avoids that a slow batch stalls the consumer while other batches are completed, for maximum
+	 * throughput. Elements within a batch keep their relative order.
+	 * @param mapFn Function that maps items from this iterator to a new value. Must return an owned value.
+	 * @param threadCnt Amount of worker threads to use.
+	 * @param batchSize Amount of elements that are dispatched to a worker thread at once.
+	 * @return New iterator that maps the values from this iterator to new values in parallel, using the
+	 * given @p mapFn.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<std::string> input = readDocuments();
+	 * 	std::set<size_t> output = CXXIter::from(input)
+	 * 		.parMapUnordered([](const std::string& document) { return expensiveHash(document); }, 8)
+	 * 		.collect<std::set>();
+	 * @endcode
+	 */
+	template<std::invocable<Item&&> TMapFn>
+	requires (!std::is_reference_v<std::invoke_result_t<const TMapFn&, Item&&>>) && std::is_constructible_v<ItemOwned, Item&&>
+	auto parMapUnordered(TMapFn mapFn, size_t threadCnt = std::thread::hardware_concurrency(), size_t batchSize = 64) {
+		using TMapFnResult = std::invoke_result_t<const TMapFn&, Item&&>;
+		return op::ParMap<TSelf, TMapFn, TMapFnResult, false>(std::move(*self()), mapFn, threadCnt, batchSize);
+	}
+
 	/**
 	 * @brief Creates an iterator that works like map(), but flattens nested containers.
 	 * @details This works by pulling elements from this iterator, passing them to the given
@@ -2163,6 +2660,100 @@ public: // CXXIter API-Surface
 			}
 		});
 	}
+
+	/**
+	 * @brief Creates a new iterator that takes the items from this iterator, and passes them on sorted by
+	 * the value extracted from each item using the given @p sortValueExtractFn.
+	 * @details In comparison to sortBy(), which invokes @p sortValueExtractFn twice for every comparison,
+	 * this variant invokes it exactly once per item (Schwartzian transform). The extracted values are stored
+	 * alongside the item's index in a packed array, which is then sorted, before the items are moved into
+	 * their final order. This is preferable whenever extracting the sort value is expensive (e.g. parsing).
+	 * The sort is always stable.
+	 * @return New iterator that returns the items of this iterator sorted.
+	 * @attention This requires to first drain the input iterator, before being able to supply a single element.
+	 * Additionally to the items, the extracted sort value and an index are stored for every item.
+	 * @tparam ORDER Decides the sort order of the resulting iterator.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<std::string> input = {"1337", "55", "500", "10000"};
+	 * 	std::vector<std::string> output = CXXIter::from(input)
+	 * 		.sortByCached<CXXIter::ASCENDING>([](const std::string& item) { return std::stoi(item); })
+	 * 		.collect<std::vector>();
+	 * 	// output == {"55", "500", "1337", "10000"}
+	 * @endcode
+	 */
+	template<SortOrder ORDER = SortOrder::ASCENDING, std::invocable<const ItemOwned&> TSortValueExtractFn>
+	requires requires(const std::invoke_result_t<TSortValueExtractFn, const ItemOwned&>& a) {
+		{ a < a }; { a > a };
+	}
+	constexpr auto sortByCached(TSortValueExtractFn sortValueExtractFn) {
+		return op::CachedSorter<TSelf, TSortValueExtractFn, ORDER>(std::move(*self()), sortValueExtractFn);
+	}
+
+	/**
+	 * @brief Creates a new iterator that takes the references from this iterator, and passes them on sorted,
+	 * using the supplied @p compareFn.
+	 * @details In comparison to sort(), which copies all items into an internal buffer and then swaps them
+	 * around during sorting, this variant only stores and sorts pointers to the items. This avoids copying
+	 * entirely, and only requires one pointer of additional memory per item - which makes it the better choice
+	 * for large items. The resulting iterator yields references to the original items in sorted order.
+	 * @note This requires the items of this iterator to be lvalue references to storage that stays valid
+	 * (and is not modified) until the resulting iterator was consumed.
+	 * @param compareFn Compare function used for the sorting of items.
+	 * @return New iterator that returns references to the items of this iterator, in sorted order.
+	 * @attention This requires to first drain the input iterator, before being able to supply a single element.
+	 * @tparam STABLE If @c true, uses @c std::stable_sort internally, if @c false uses @c std::sort
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<std::string> input = {"test1", "test2", "test23", "test", "tes"};
+	 * 	std::vector<std::string> output = CXXIter::from(input)
+	 * 		.sortIndirect<true>([](const std::string& a, const std::string& b) {
+	 * 			return (a.size() < b.size());
+	 * 		})
+	 * 		.copied()
+	 * 		.collect<std::vector>();
+	 * 	// output == {"tes", "test", "test1", "test2", "test23"}
+	 * @endcode
+	 */
+	template<bool STABLE, std::invocable<const ItemOwned&, const ItemOwned&> TCompareFn>
+	requires std::is_lvalue_reference_v<Item>
+	constexpr auto sortIndirect(TCompareFn compareFn) {
+		return op::IndirectSorter<TSelf, TCompareFn, STABLE>(std::move(*self()), compareFn);
+	}
+
+	/**
+	 * @brief Creates a new iterator that takes the references from this iterator, and passes them on sorted.
+	 * @details This is the variant of sortIndirect(TCompareFn) for items supporting comparison operators.
+	 * @note This requires the items of this iterator to be lvalue references to storage that stays valid
+	 * (and is not modified) until the resulting iterator was consumed.
+	 * @return New iterator that returns references to the items of this iterator, in sorted order.
+	 * @attention This requires to first drain the input iterator, before being able to supply a single element.
+	 * @tparam ORDER Decides the sort order of the resulting iterator.
+	 * @tparam STABLE If @c true, uses @c std::stable_sort internally, if @c false uses @c std::sort
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<float> input = {1.0f, 2.0f, 0.5f, 3.0f, -42.0f};
+	 * 	std::vector<float> output = CXXIter::from(input)
+	 * 		.sortIndirect<CXXIter::DESCENDING>()
+	 * 		.copied()
+	 * 		.collect<std::vector>();
+	 * 	// output == {3.0f, 2.0f, 1.0f, 0.5f, -42.0f}
+	 * @endcode
+	 */
+	template<SortOrder ORDER = SortOrder::ASCENDING, bool STABLE = false>
+	requires std::is_lvalue_reference_v<Item> && requires(const ItemOwned& a) { { a < a }; { a > a }; }
+	constexpr auto sortIndirect() {
+		return sortIndirect<STABLE>([](const ItemOwned& a, const ItemOwned& b) {
+			if constexpr(ORDER == SortOrder::ASCENDING) {
+				return (a < b);
+			} else {
+				return (a > b);
+			}
+		});
+	}
 //@}
 };
 
@@ -2184,7 +2775,7 @@ public: // CXXIter API-Surface
 	 * @return CXXIter move source from the given container.
 	 */
 	template<typename TContainer>
-	requires (!std::is_reference_v<TContainer> && !util::is_const_reference_v<TContainer> && concepts::SourceContainer<TContainer>)
+	requires (!std::is_reference_v<TContainer> && !util::is_const_reference_v<TContainer> && !std::is_array_v<TContainer> && !concepts::ContiguousView<TContainer> && concepts::SourceContainer<TContainer>)
 	constexpr SrcMov<std::remove_cvref_t<TContainer>> from(TContainer&& container) {
 		return SrcMov<std::remove_cvref_t<TContainer>>(std::forward<TContainer>(container));
 	}
@@ -2197,7 +2788,7 @@ public: // CXXIter API-Surface
 	 * @return CXXIter mutable-reference source from the given container.
 	 */
 	template<typename TContainer>
-	requires (!std::is_reference_v<TContainer> && !util::is_const_reference_v<TContainer> && concepts::SourceContainer<TContainer>)
+	requires (!std::is_reference_v<TContainer> && !util::is_const_reference_v<TContainer> && !std::is_array_v<TContainer> && !concepts::ContiguousView<TContainer> && concepts::SourceContainer<TContainer>)
 	constexpr SrcRef<std::remove_cvref_t<TContainer>> from(TContainer& container) {
 		return SrcRef<std::remove_cvref_t<TContainer>>(container);
 	}
@@ -2210,10 +2801,478 @@ public: // CXXIter API-Surface
 	 * @return CXXIter const-reference source from the given container.
 	 */
 	template<typename TContainer>
-	requires (!std::is_reference_v<TContainer> && !util::is_const_reference_v<TContainer> && concepts::SourceContainer<TContainer>)
+	requires (!std::is_reference_v<TContainer> && !util::is_const_reference_v<TContainer> && !std::is_array_v<TContainer> && !concepts::ContiguousView<TContainer> && concepts::SourceContainer<TContainer>)
 	constexpr SrcCRef<std::remove_cvref_t<TContainer>> from(const TContainer& container) {
 		return SrcCRef<std::remove_cvref_t<TContainer>>(container);
 	}
+
+	/**
+	 * @brief Construct a CXXIter view source from the given non-owning @p view onto contiguous memory
+	 * (@c std::span or @c std::string_view).
+	 * @details The source only stores a pointer range into the viewed memory, and never allocates. It passes
+	 * references to the viewed items through the iterator, which are const for views onto const items.
+	 * The resulting iterator is exact-size, double-ended and contiguous, and advanceBy() is O(1).
+	 * @note The memory viewed by @p view has to outlive the iterator.
+	 * @param view View to construct a CXXIter source from.
+	 * @return CXXIter view source over the items of the given @p view.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string_view input = "Hello";
+	 * 	std::string output = CXXIter::from(input)
+	 * 		.reverse()
+	 * 		.collect<std::basic_string>();
+	 * 	// output == "olleH"
+	 * @endcode
+	 */
+	template<typename TView>
+	requires concepts::ContiguousView<std::remove_cvref_t<TView>>
+	constexpr auto from(TView&& view) {
+		using TItem = std::remove_reference_t<decltype(*view.data())>;
+		return SrcView<TItem>(view.data(), view.size());
+	}
+
+	/**
+	 * @brief Construct a CXXIter view source from the given C array.
+	 * @details See CXXIter::from() for views. For const arrays, const references are passed through the iterator.
+	 * @note For string literals, this includes the terminating null character.
+	 * @param array Array to construct a CXXIter source from.
+	 * @return CXXIter view source over the items of the given @p array.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	int input[] = {1, 2, 3};
+	 * 	int output = CXXIter::from(input).sum();
+	 * 	// output == 6
+	 * @endcode
+	 */
+	template<typename TItem, size_t N>
+	constexpr SrcView<TItem> from(TItem (&array)[N]) {
+		return SrcView<TItem>(array, N);
+	}
+
+	/**
+	 * @brief Construct a CXXIter view source from the given pointer @p data to @p size contiguous items.
+	 * @details See CXXIter::from() for views. For pointers to const, const references are passed through the iterator.
+	 * @note The memory pointed to by @p data has to outlive the iterator.
+	 * @param data Pointer to the first item.
+	 * @param size Amount of items.
+	 * @return CXXIter view source over the given items.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::unique_ptr<float[]> input(new float[3] {1.0f, 2.0f, 3.0f});
+	 * 	std::vector<float> output = CXXIter::from(input.get(), 3)
+	 * 		.map([](float item) { return item * 2; })
+	 * 		.collect<std::vector>();
+	 * 	// output == {2.0f, 4.0f, 6.0f}
+	 * @endcode
+	 */
+	template<typename TItem>
+	constexpr SrcView<TItem> from(TItem* data, size_t size) {
+		return SrcView<TItem>(data, size);
+	}
+
+	#ifdef CXXITER_HAS_MMAP
+	/**
+	 * @brief Construct a CXXIter source that memory-maps the file at the given @p path, and passes
+	 * const references to the fixed-size binary records of type @p TRecord stored in it through the iterator.
+	 * @details The records are read directly from the mapping, without being copied. The resulting iterator
+	 * is exact-size, double-ended and contiguous, such that all contiguous fast-paths apply to the file's contents.
+	 * Trailing bytes at the end of the file that do not form a complete record are ignored.
+	 * @param path Path of the file to map.
+	 * @param advice Access pattern hint for the kernel (@c madvise).
+	 * @return CXXIter source over the records in the given file.
+	 * @throws std::system_error when the file could not be opened or mapped.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	struct LogRecord { uint64_t timestamp; uint32_t code; uint32_t value; };
+	 * 	size_t errorCnt = CXXIter::fromMappedFile<LogRecord>("/var/log/records.bin")
+	 * 		.filter([](const LogRecord& record) { return (record.code >= 500); })
+	 * 		.count();
+	 * @endcode
+	 */
+	template<typename TRecord>
+	requires std::is_trivially_copyable_v<TRecord>
+	SrcMappedFile<TRecord> fromMappedFile(const std::filesystem::path& path, MappedFileAdvice advice = MappedFileAdvice::SEQUENTIAL) {
+		return SrcMappedFile<TRecord>(path, advice);
+	}
+	#endif
+
+	/**
+	 * @brief Construct a CXXIter source that splits the given @p input at the given @p delimiter, yielding
+	 * views to the parts into the given @p input buffer.
+	 * @details No characters are copied. The delimiters are searched using @c memchr. Like in most other
+	 * languages, an empty input yields one empty part, and a trailing delimiter yields an empty last part.
+	 * CXXIter::splitFrom() follows the same semantics for streams.
+	 * The size hint is exact, and is computed by counting the remaining delimiters when it is requested.
+	 * @note The buffer referenced by @p input has to outlive the iterator and its items.
+	 * @param input String to split.
+	 * @param delimiter Character at which to split the @p input.
+	 * @return CXXIter source yielding the parts of @p input as @c std::string_view.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "a,bc,,d";
+	 * 	std::vector<std::string_view> output = CXXIter::split(input, ',')
+	 * 		.collect<std::vector>();
+	 * 	// output == {"a", "bc", "", "d"}
+	 * @endcode
+	 */
+	inline StringSplitter<false> split(std::string_view input, char delimiter) {
+		return StringSplitter<false>(input, delimiter);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that splits the given @p input into lines, yielding views to the lines
+	 * into the given @p input buffer.
+	 * @details No characters are copied. The line-breaks are searched using @c memchr. Both @c "\n" and
+	 * @c "\r\n" are accepted as line-break, and are not part of the yielded lines. A line-break at the end of
+	 * @p input does not yield an additional empty line. The size hint is exact, and is computed by counting the
+	 * remaining line-breaks when it is requested.
+	 * @note The buffer referenced by @p input has to outlive the iterator and its items. For the contents of a
+	 * file, this can e.g. be a memory-mapped buffer.
+	 * @param input String to split into lines.
+	 * @return CXXIter source yielding the lines of @p input as @c std::string_view.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "first\r\nsecond\n\nfourth\n";
+	 * 	std::vector<std::string_view> output = CXXIter::lines(input)
+	 * 		.collect<std::vector>();
+	 * 	// output == {"first", "second", "", "fourth"}
+	 * @endcode
+	 */
+	inline StringSplitter<true> lines(std::string_view input) {
+		return StringSplitter<true>(input, '\n');
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that parses the given delimited text @p input (CSV), yielding each record
+	 * as a CXXIter::CsvRecord, whose fields are views into the @p input buffer.
+	 * @details Fields can be quoted, and may then contain separators, line-breaks and doubled quotes. Both @c "\n"
+	 * and @c "\r\n" are accepted as line-break. Records are located using @c memchr, and records without quotes are
+	 * split using @c memchr as well. No allocation takes place per record.
+	 * @attention The yielded record is reused, and is thus only valid until the next element is requested from the
+	 * iterator. Copying it (e.g. by @c groupBy) is cheap though, since it only contains views.
+	 * @note The buffer referenced by @p input has to outlive the iterator and the yielded fields.
+	 * @param input Delimited text to parse.
+	 * @param options Options for the parser (separator, quote, header).
+	 * @return CXXIter source yielding the records of @p input.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "name,age\nAlice,42\n\"Bob, Jr.\",7\n";
+	 * 	std::vector<std::string_view> output = CXXIter::fromCsv(input, {.skipHeader = true})
+	 * 		.map([](const CXXIter::CsvRecord& record) { return record[0]; })
+	 * 		.collect<std::vector>();
+	 * 	// output == {"Alice", "Bob, Jr."}
+	 * @endcode
+	 */
+	inline CsvReader<false> fromCsv(std::string_view input, const CsvOptions& options = {}) {
+		return CsvReader<false>(input, options);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that parses the given delimited text @p input (CSV), yielding only the
+	 * given @p columns of each record as a CXXIter::CsvRecord, whose fields are views into the @p input buffer.
+	 * @details Field @c i of the yielded records contains the column with index @c columns[i]. Columns missing in
+	 * a record are yielded as empty fields. See CXXIter::fromCsv() for details.
+	 * @attention The yielded record is reused, and is thus only valid until the next element is requested from the
+	 * iterator.
+	 * @param input Delimited text to parse.
+	 * @param columns Indices of the columns to project into the yielded records.
+	 * @param options Options for the parser (separator, quote, header).
+	 * @return CXXIter source yielding the projected records of @p input.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "Alice,Smith,42\nBob,Jones,7\n";
+	 * 	std::vector<std::string> output = CXXIter::fromCsvColumns(input, {2, 0})
+	 * 		.map([](const CXXIter::CsvRecord& record) { return std::string(record[0]) + ":" + std::string(record[1]); })
+	 * 		.collect<std::vector>();
+	 * 	// output == {"42:Alice", "7:Bob"}
+	 * @endcode
+	 */
+	inline CsvReader<true> fromCsvColumns(std::string_view input, const std::vector<size_t>& columns, const CsvOptions& options = {}) {
+		return CsvReader<true>(input, options, columns);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that parses the given tab-separated text @p input (TSV).
+	 * @details This is CXXIter::fromCsv(), with the tabulator as separator.
+	 * @attention The yielded record is reused, and is thus only valid until the next element is requested from the
+	 * iterator.
+	 * @param input Tab-separated text to parse.
+	 * @param options Options for the parser (quote, header). The separator in @p options is ignored.
+	 * @return CXXIter source yielding the records of @p input.
+	 */
+	inline CsvReader<false> fromTsv(std::string_view input, CsvOptions options = {}) {
+		options.separator = '\t';
+		return CsvReader<false>(input, options);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that parses the given tab-separated text @p input (TSV), yielding only the
+	 * given @p columns of each record.
+	 * @details This is CXXIter::fromCsvColumns(), with the tabulator as separator.
+	 * @attention The yielded record is reused, and is thus only valid until the next element is requested from the
+	 * iterator.
+	 * @param input Tab-separated text to parse.
+	 * @param columns Indices of the columns to project into the yielded records.
+	 * @param options Options for the parser (quote, header). The separator in @p options is ignored.
+	 * @return CXXIter source yielding the projected records of @p input.
+	 */
+	inline CsvReader<true> fromTsvColumns(std::string_view input, const std::vector<size_t>& columns, CsvOptions options = {}) {
+		options.separator = '\t';
+		return CsvReader<true>(input, options, columns);
+	}
+
+	/**
+	 * @brief Default size of the blocks read by the streaming sources such as CXXIter::linesFrom() and CXXIter::recordsFrom().
+	 */
+	static constexpr size_t DEFAULT_STREAM_BLOCK_SIZE = 1024 * 1024;
+
+	/**
+	 * @brief Construct a CXXIter source that reads the given @p stream in large blocks, and yields copies of its
+	 * lines.
+	 * @details This avoids one stream call per line, as done by @c std::getline. Both @c "\n" and @c "\r\n" are
+	 * accepted as line-break. Lines that straddle two blocks are moved to the front of the buffer before reading
+	 * the next block, and lines longer than @p blockSize grow the buffer. A line-break at the end of the stream
+	 * does not yield an additional empty line (like CXXIter::lines()).
+	 * @param stream Stream to read the lines from.
+	 * @param blockSize Size of the blocks read from the @p stream.
+	 * @return CXXIter source yielding the lines of @p stream as @c std::string.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::ifstream file("/var/log/messages");
+	 * 	size_t errorCnt = CXXIter::linesFrom(file)
+	 * 		.filter([](const std::string& line) { return line.starts_with("ERROR"); })
+	 * 		.count();
+	 * @endcode
+	 */
+	inline StreamSplitter<util::IStreamBlockReader, true> linesFrom(std::istream& stream, size_t blockSize = DEFAULT_STREAM_BLOCK_SIZE) {
+		return StreamSplitter<util::IStreamBlockReader, true>(util::IStreamBlockReader(stream), '\n', blockSize);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that reads the given @p stream in large blocks, and yields copies of the
+	 * records separated by @p delimiter.
+	 * @details See CXXIter::linesFrom() for details. In contrast to that, no @c '\r' is stripped from the records,
+	 * and - like in CXXIter::split() - a trailing delimiter yields an empty last record, as does an empty stream.
+	 * @param stream Stream to read the records from.
+	 * @param delimiter Character separating the records.
+	 * @param blockSize Size of the blocks read from the @p stream.
+	 * @return CXXIter source yielding the records of @p stream as @c std::string.
+	 */
+	inline StreamSplitter<util::IStreamBlockReader, false> splitFrom(std::istream& stream, char delimiter, size_t blockSize = DEFAULT_STREAM_BLOCK_SIZE) {
+		return StreamSplitter<util::IStreamBlockReader, false>(util::IStreamBlockReader(stream), delimiter, blockSize);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that reads the given @p stream in large blocks, and yields copies of the
+	 * fixed-size binary records of type @p TRecord within the current block.
+	 * @details Records that straddle two blocks are moved to the front of the buffer before reading the next block.
+	 * Trailing bytes that do not form a complete record are ignored.
+	 * @param stream Stream to read the records from.
+	 * @param blockSize Size of the blocks read from the @p stream.
+	 * @return CXXIter source yielding the records in @p stream.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	struct LogRecord { uint64_t timestamp; uint32_t code; uint32_t value; };
+	 * 	std::ifstream file("/var/log/records.bin", std::ios::binary);
+	 * 	size_t errorCnt = CXXIter::recordsFrom<LogRecord>(file)
+	 * 		.filter([](const LogRecord& record) { return (record.code >= 500); })
+	 * 		.count();
+	 * @endcode
+	 */
+	template<typename TRecord>
+	requires std::is_trivially_copyable_v<TRecord> && std::is_default_constructible_v<TRecord>
+	StreamRecords<util::IStreamBlockReader, TRecord> recordsFrom(std::istream& stream, size_t blockSize = DEFAULT_STREAM_BLOCK_SIZE) {
+		return StreamRecords<util::IStreamBlockReader, TRecord>(util::IStreamBlockReader(stream), blockSize);
+	}
+
+	#ifdef CXXITER_HAS_POSIX_IO
+	/**
+	 * @brief Construct a CXXIter source that reads the given file descriptor @p fd in large blocks, and yields
+	 * copies of its lines.
+	 * @details The kernel is advised of the sequential access (@c posix_fadvise), so it reads ahead while the
+	 * current block is processed. See CXXIter::linesFrom(std::istream&, size_t) for details.
+	 * @param fd File descriptor to read from. It is not closed by the iterator.
+	 * @param blockSize Size of the blocks read from @p fd.
+	 * @return CXXIter source yielding the lines read from @p fd as @c std::string.
+	 * @throws std::system_error (on iteration) when reading from @p fd fails.
+	 */
+	inline StreamSplitter<util::FdBlockReader, true> linesFrom(int fd, size_t blockSize = DEFAULT_STREAM_BLOCK_SIZE) {
+		return StreamSplitter<util::FdBlockReader, true>(util::FdBlockReader(fd), '\n', blockSize);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that reads the given file descriptor @p fd in large blocks, and yields
+	 * copies of the records separated by @p delimiter.
+	 * @details See CXXIter::splitFrom(std::istream&, char, size_t) and CXXIter::linesFrom(int, size_t) for details.
+	 * @param fd File descriptor to read from. It is not closed by the iterator.
+	 * @param delimiter Character separating the records.
+	 * @param blockSize Size of the blocks read from @p fd.
+	 * @return CXXIter source yielding the records read from @p fd as @c std::string.
+	 * @throws std::system_error (on iteration) when reading from @p fd fails.
+	 */
+	inline StreamSplitter<util::FdBlockReader, false> splitFrom(int fd, char delimiter, size_t blockSize = DEFAULT_STREAM_BLOCK_SIZE) {
+		return StreamSplitter<util::FdBlockReader, false>(util::FdBlockReader(fd), delimiter, blockSize);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that reads the given file descriptor @p fd in large blocks, and yields copies
+	 * of the fixed-size binary records of type @p TRecord within the current block.
+	 * @details See CXXIter::recordsFrom(std::istream&, size_t) for details.
+	 * @param fd File descriptor to read from. It is not closed by the iterator.
+	 * @param blockSize Size of the blocks read from @p fd.
+	 * @return CXXIter source yielding the records read from @p fd.
+	 * @throws std::system_error (on iteration) when reading from @p fd fails.
+	 */
+	template<typename TRecord>
+	requires std::is_trivially_copyable_v<TRecord> && std::is_default_constructible_v<TRecord>
+	StreamRecords<util::FdBlockReader, TRecord> recordsFrom(int fd, size_t blockSize = DEFAULT_STREAM_BLOCK_SIZE) {
+		return StreamRecords<util::FdBlockReader, TRecord>(util::FdBlockReader(fd), blockSize);
+	}
+	#endif
+
+	/**
+	 * @brief Construct a CXXIter source that yields the indices of all set bits in the given bitmap @p words,
+	 * in ascending order.
+	 * @details Bit @c i of @c words[w] has the index <tt>w * 64 + i</tt>. The bitmap is scanned one word at a
+	 * time using @c std::countr_zero, so the runtime depends on the amount of set bits, instead of the size
+	 * of the bitmap. advanceBy() skips whole words using @c std::popcount. The exact size hint is computed
+	 * (by counting the remaining set bits) when it is first requested.
+	 * @note The buffer referenced by @p words has to outlive the iterator.
+	 * @param words Bitmap to scan for set bits.
+	 * @return CXXIter source yielding the indices of the set bits in @p words.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<uint64_t> bitmap = {0b1010, 0, 0b1};
+	 * 	std::vector<size_t> output = CXXIter::fromBits(bitmap)
+	 * 		.collect<std::vector>();
+	 * 	// output == {1, 3, 128}
+	 * @endcode
+	 */
+	inline SrcBits<std::span<const uint64_t>> fromBits(std::span<const uint64_t> words) {
+		return SrcBits<std::span<const uint64_t>>(words);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that yields the indices of all set bits in the given @p bitset,
+	 * in ascending order.
+	 * @details The bitset is copied into the iterator (as 64bit words). See CXXIter::fromBits() for details.
+	 * @param bitset Bitset to scan for set bits.
+	 * @return CXXIter source yielding the indices of the set bits in @p bitset.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::bitset<100> bitset;
+	 * 	bitset.set(3).set(70);
+	 * 	std::vector<size_t> output = CXXIter::fromBitset(bitset)
+	 * 		.collect<std::vector>();
+	 * 	// output == {3, 70}
+	 * @endcode
+	 */
+	template<size_t N>
+	SrcBits<std::array<uint64_t, (N + 63) / 64>> fromBitset(const std::bitset<N>& bitset) {
+		return SrcBits<std::array<uint64_t, (N + 63) / 64>>(util::bitsetToWords(bitset));
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that lazily decodes the varint-encoded (LEB128) integers in the given
+	 * @p input buffer, as produced by CXXIter::encodeVarint().
+	 * @details advanceBy() skips values by locating their last byte, without decoding them. The exact size hint
+	 * is computed by counting the remaining terminating bytes when it is requested.
+	 * @note The buffer referenced by @p input has to outlive the iterator.
+	 * @param input Buffer with the encoded values.
+	 * @return CXXIter source yielding the decoded values.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<uint32_t> input = {1, 300, 70000};
+	 * 	std::vector<uint8_t> encoded = CXXIter::encodeVarint<uint32_t>(input);
+	 * 	std::vector<uint32_t> output = CXXIter::fromVarint<uint32_t>(encoded)
+	 * 		.collect<std::vector>();
+	 * 	// output == {1, 300, 70000}
+	 * @endcode
+	 */
+	template<std::unsigned_integral TValue = uint64_t>
+	SrcVarint<TValue, false> fromVarint(std::span<const uint8_t> input) {
+		return SrcVarint<TValue, false>(input);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that lazily decodes the varint-encoded differences between consecutive
+	 * integers in the given @p input buffer, as produced by CXXIter::encodeDeltaVarint().
+	 * @note The buffer referenced by @p input has to outlive the iterator.
+	 * @param input Buffer with the encoded differences.
+	 * @return CXXIter source yielding the decoded values.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<uint64_t> sortedIds = {1000, 1003, 1010};
+	 * 	std::vector<uint8_t> encoded = CXXIter::encodeDeltaVarint<uint64_t>(sortedIds);
+	 * 	// encoded == {0xE8, 0x07, 0x03, 0x07}
+	 * 	std::vector<uint64_t> output = CXXIter::fromDeltaVarint(encoded)
+	 * 		.collect<std::vector>();
+	 * 	// output == {1000, 1003, 1010}
+	 * @endcode
+	 */
+	template<std::unsigned_integral TValue = uint64_t>
+	SrcVarint<TValue, true> fromDeltaVarint(std::span<const uint8_t> input) {
+		return SrcVarint<TValue, true>(input);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that lazily decodes the bit-packed blocks of @c uint32_t values in the
+	 * given @p input buffer, as produced by CXXIter::encodeBitPacked().
+	 * @details Only one block of 128 values is held in decoded form at a time. advanceBy() skips whole blocks by
+	 * only reading their header, without decoding them.
+	 * @note The buffer referenced by @p input has to outlive the iterator.
+	 * @param input Buffer with the encoded blocks.
+	 * @return CXXIter source yielding the decoded values.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<uint32_t> input = {3, 1, 4, 1, 5};
+	 * 	std::vector<uint8_t> encoded = CXXIter::encodeBitPacked(input);
+	 * 	std::vector<uint32_t> output = CXXIter::fromBitPacked(encoded)
+	 * 		.collect<std::vector>();
+	 * 	// output == {3, 1, 4, 1, 5}
+	 * @endcode
+	 */
+	inline SrcBitPacked<false> fromBitPacked(std::span<const uint8_t> input) {
+		return SrcBitPacked<false>(input);
+	}
+
+	/**
+	 * @brief Construct a CXXIter source that lazily decodes the bit-packed blocks of differences between consecutive
+	 * @c uint32_t values in the given @p input buffer, as produced by CXXIter::encodeDeltaBitPacked().
+	 * @details The values of each block are restored using a prefix-sum, starting at the base value stored in the
+	 * block's header. This allows advanceBy() to skip whole blocks, without decoding them.
+	 * @note The buffer referenced by @p input has to outlive the iterator.
+	 * @param input Buffer with the encoded blocks.
+	 * @return CXXIter source yielding the decoded values.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::vector<uint32_t> sortedIds = CXXIter::range<uint32_t>(1000, 2000, 3).collect<std::vector>();
+	 * 	std::vector<uint8_t> encoded = CXXIter::encodeDeltaBitPacked(sortedIds);
+	 * 	uint32_t output = CXXIter::fromDeltaBitPacked(encoded)
+	 * 		.skip(200)
+	 * 		.next().value();
+	 * 	// output == 1600
+	 * @endcode
+	 */
+	inline SrcBitPacked<true> fromDeltaBitPacked(std::span<const uint8_t> input) {
+		return SrcBitPacked<true>(input);
+	}
 //@}
 
 
@@ -2263,6 +3322,32 @@ public: // CXXIter API-Surface
 		return FunctionGenerator<TGeneratorFnResult, TGeneratorFn>(generatorFn);
 	}
 
+	/**
+	 * @brief Generator source that receives its elements from the given @p channel.
+	 * @details The resulting iterator blocks while the channel is empty, and ends once the channel was closed
+	 * and all of its remaining elements were received. Multiple threads can send into the channel concurrently,
+	 * and multiple iterators can receive from the same channel (each element is received by exactly one of them).
+	 * The @p channel has to outlive the returned iterator.
+	 * @param channel Channel to receive the elements of the resulting iterator from.
+	 * @return CXXIter iterator over the elements received from the given @p channel.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	CXXIter::Channel<int> channel(64);
+	 * 	std::thread producer([&channel]() {
+	 * 		CXXIter::range(1, 100).sendTo(channel);
+	 * 		channel.close();
+	 * 	});
+	 * 	int output = CXXIter::fromChannel(channel).sum();
+	 * 	producer.join();
+	 * 	// output == 5050
+	 * @endcode
+	 */
+	template<typename TItem>
+	ChannelSource<TItem> fromChannel(Channel<TItem>& channel) {
+		return ChannelSource<TItem>(channel);
+	}
+
 	#ifdef CXXITER_HAS_COROUTINE
 	/**
 	 * @brief Generator source that produces a new iterator over the elements produced by the
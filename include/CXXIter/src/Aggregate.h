@@ -0,0 +1,291 @@
+#pragma once
+
+#include <cstdlib>
+#include <utility>
+#include <optional>
+#include <concepts>
+#include <type_traits>
+
+#include "Common.h"
+
+/**
+ * @brief Namespace that contains the aggregators usable with CXXIter::IterApi::aggregate().
+ * @details Aggregators are small descriptors of a reduction (such as a count, a sum or a maximum).
+ * Any number of them can be passed to CXXIter::IterApi::aggregate(), which then runs all of them
+ * within a single traversal of the iterator, returning a @c std::tuple of their results.
+ *
+ * To write a custom aggregator, provide a type with a method template @c init<TItem>() that returns
+ * a state object. The state has to provide an @c add() method, which is called with every element
+ * (as lvalue reference to @c std::remove_reference_t<TItem>), and a @c finish() method, returning the
+ * aggregator's result.
+ */
+namespace CXXIter::agg {
+
+	// ################################################################################################
+	// CONCEPTS
+	// ################################################################################################
+
+	/**
+	 * @brief Concept that checks whether @p TAggregator is an aggregator that can be run on
+	 * elements of type @p TItem.
+	 */
+	template<typename TAggregator, typename TItem>
+	concept Aggregator = requires(const TAggregator& aggregator, std::remove_reference_t<TItem>& item) {
+		aggregator.template init<TItem>();
+		aggregator.template init<TItem>().add(item);
+		aggregator.template init<TItem>().finish();
+	};
+
+	/** @private */
+	template<typename TResult, typename TItem>
+	using result_or_owned = std::conditional_t<std::is_void_v<TResult>, std::remove_cvref_t<TItem>, TResult>;
+
+
+	// ################################################################################################
+	// AGGREGATORS
+	// ################################################################################################
+
+	/** @private */
+	template<typename TPredicateFn>
+	struct Count {
+		TPredicateFn predicateFn;
+
+		template<typename TItem>
+		struct State {
+			TPredicateFn predicateFn;
+			size_t cnt = 0;
+			constexpr void add(const std::remove_reference_t<TItem>& item) {
+				if(predicateFn(item)) { cnt += 1; }
+			}
+			constexpr size_t finish() { return cnt; }
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {predicateFn}; }
+	};
+
+	/**
+	 * @brief Aggregator that counts the elements of the iterator.
+	 * @return Aggregator whose result is the amount of elements as @c size_t.
+	 */
+	constexpr auto count() {
+		return Count{[](const auto&) { return true; }};
+	}
+
+	/**
+	 * @brief Aggregator that counts the elements of the iterator, for which the given @p predicateFn returns @c true.
+	 * @param predicateFn Predicate deciding whether an element contributes to the count.
+	 * @return Aggregator whose result is the amount of matching elements as @c size_t.
+	 */
+	template<typename TPredicateFn>
+	constexpr auto count(TPredicateFn predicateFn) {
+		return Count<TPredicateFn>{predicateFn};
+	}
+
+	/** @private */
+	template<typename TResult>
+	struct Sum {
+		TResult startValue;
+
+		template<typename TItem>
+		struct State {
+			TResult result;
+			constexpr void add(const std::remove_reference_t<TItem>& item) { result += item; }
+			constexpr TResult finish() { return std::move(result); }
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {startValue}; }
+	};
+	/** @private */
+	template<>
+	struct Sum<void> {
+		template<typename TItem>
+		struct State {
+			std::remove_cvref_t<TItem> result = std::remove_cvref_t<TItem>();
+			constexpr void add(const std::remove_reference_t<TItem>& item) { result += item; }
+			constexpr std::remove_cvref_t<TItem> finish() { return std::move(result); }
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {}; }
+	};
+
+	/**
+	 * @brief Aggregator that calculates the sum of all elements of the iterator.
+	 * @tparam TResult Type of the sum. Defaults to the owned element type of the iterator.
+	 * @return Aggregator whose result is the sum of all elements.
+	 */
+	template<typename TResult = void>
+	constexpr Sum<TResult> sum() { return {}; }
+
+	/**
+	 * @brief Aggregator that calculates the sum of all elements of the iterator, starting at @p startValue.
+	 * @param startValue Value from which to start the sum.
+	 * @return Aggregator whose result is the sum of all elements.
+	 */
+	template<typename TResult>
+	constexpr Sum<TResult> sum(TResult startValue) { return {startValue}; }
+
+	/** @private */
+	template<typename TResult, typename TFoldFn>
+	struct Fold {
+		TResult startValue;
+		TFoldFn foldFn;
+
+		template<typename TItem>
+		struct State {
+			TResult result;
+			TFoldFn foldFn;
+			constexpr void add(std::remove_reference_t<TItem>& item) { foldFn(result, item); }
+			constexpr TResult finish() { return std::move(result); }
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {startValue, foldFn}; }
+	};
+
+	/**
+	 * @brief Aggregator that works like CXXIter::IterApi::fold().
+	 * @param startValue The initial working value passed to @p foldFn.
+	 * @param foldFn Function called for each element, with the working value and the element.
+	 * @return Aggregator whose result is the final working value.
+	 */
+	template<typename TResult, typename TFoldFn>
+	constexpr Fold<TResult, TFoldFn> fold(TResult startValue, TFoldFn foldFn) { return {startValue, foldFn}; }
+
+	/** @private */
+	template<typename TCompValueExtractFn, bool MAX>
+	struct MinMaxBy {
+		TCompValueExtractFn compValueExtractFn;
+
+		template<typename TItem>
+		struct State {
+			using CompValue = std::remove_cvref_t<std::invoke_result_t<TCompValueExtractFn, std::remove_reference_t<TItem>&>>;
+			TCompValueExtractFn compValueExtractFn;
+			IterValue<TItem> result = {};
+			std::optional<CompValue> resultValue = {};
+
+			constexpr void add(std::remove_reference_t<TItem>& item) {
+				CompValue itemValue = compValueExtractFn(item);
+				bool isBetter;
+				if constexpr(MAX) {
+					isBetter = (!resultValue.has_value() || itemValue > resultValue.value());
+				} else {
+					isBetter = (!resultValue.has_value() || itemValue < resultValue.value());
+				}
+				if(isBetter) {
+					result = item;
+					resultValue = std::move(itemValue);
+				}
+			}
+			constexpr IterValue<TItem> finish() { return std::move(result); }
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {compValueExtractFn}; }
+	};
+
+	/**
+	 * @brief Aggregator that yields the smallest element. Comparison is done using the values
+	 * returned by invoking the given @p compValueExtractFn on each element.
+	 * @param compValueExtractFn Function extracting the value by which an element is compared to others.
+	 * @return Aggregator whose result is a CXXIter::IterValue containing the smallest element (if any).
+	 */
+	template<typename TCompValueExtractFn>
+	constexpr MinMaxBy<TCompValueExtractFn, false> minBy(TCompValueExtractFn compValueExtractFn) { return {compValueExtractFn}; }
+
+	/**
+	 * @brief Aggregator that yields the largest element. Comparison is done using the values
+	 * returned by invoking the given @p compValueExtractFn on each element.
+	 * @param compValueExtractFn Function extracting the value by which an element is compared to others.
+	 * @return Aggregator whose result is a CXXIter::IterValue containing the largest element (if any).
+	 */
+	template<typename TCompValueExtractFn>
+	constexpr MinMaxBy<TCompValueExtractFn, true> maxBy(TCompValueExtractFn compValueExtractFn) { return {compValueExtractFn}; }
+
+	/**
+	 * @brief Aggregator that yields the smallest element.
+	 * @return Aggregator whose result is a CXXIter::IterValue containing the smallest element (if any).
+	 */
+	constexpr auto min() {
+		return minBy([](const auto& item) -> const auto& { return item; });
+	}
+
+	/**
+	 * @brief Aggregator that yields the largest element.
+	 * @return Aggregator whose result is a CXXIter::IterValue containing the largest element (if any).
+	 */
+	constexpr auto max() {
+		return maxBy([](const auto& item) -> const auto& { return item; });
+	}
+
+	/** @private */
+	template<StatisticNormalization NORM, typename TResult, typename TCount>
+	struct Mean {
+		template<typename TItem>
+		struct State {
+			using Result = result_or_owned<TResult, TItem>;
+			using Count = result_or_owned<TCount, TItem>;
+			Result sum = Result();
+			size_t cnt = 0;
+
+			constexpr void add(const std::remove_reference_t<TItem>& item) {
+				sum += item;
+				cnt += 1;
+			}
+			constexpr std::optional<Result> finish() {
+				if constexpr(NORM == StatisticNormalization::N) {
+					if(cnt > 0) { return sum / static_cast<Count>(cnt); }
+				} else {
+					if(cnt > 1) { return sum / static_cast<Count>(cnt - 1); }
+				}
+				return {};
+			}
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {}; }
+	};
+
+	/**
+	 * @brief Aggregator that calculates the mean of all elements. Works like CXXIter::IterApi::mean().
+	 * @tparam NORM Type of the statistical normalization variant to use for the calculation.
+	 * @tparam TResult Type of the mean-calculation's result. Defaults to the owned element type.
+	 * @tparam TCount Type the element counter is converted into, before dividing the sum by it.
+	 * Defaults to the owned element type.
+	 * @return Aggregator whose result is a @c std::optional containing the mean (if defined).
+	 */
+	template<StatisticNormalization NORM = StatisticNormalization::N, typename TResult = void, typename TCount = void>
+	constexpr Mean<NORM, TResult, TCount> mean() { return {}; }
+
+	/** @private */
+	template<typename TPredicateFn, bool ALL>
+	struct AnyAll {
+		TPredicateFn predicateFn;
+
+		template<typename TItem>
+		struct State {
+			TPredicateFn predicateFn;
+			bool result = ALL;
+			constexpr void add(const std::remove_reference_t<TItem>& item) {
+				if(result != ALL) { return; } // result already decided
+				if(static_cast<bool>(predicateFn(item)) != ALL) { result = !ALL; }
+			}
+			constexpr bool finish() { return result; }
+		};
+		template<typename TItem>
+		constexpr State<TItem> init() const { return {predicateFn}; }
+	};
+
+	/**
+	 * @brief Aggregator that tests whether any of the elements matches the given @p predicateFn.
+	 * @param predicateFn Predicate to test the elements against.
+	 * @return Aggregator whose result is @c true if the predicate returned @c true for any element.
+	 */
+	template<typename TPredicateFn>
+	constexpr AnyAll<TPredicateFn, false> any(TPredicateFn predicateFn) { return {predicateFn}; }
+
+	/**
+	 * @brief Aggregator that tests whether all of the elements match the given @p predicateFn.
+	 * @param predicateFn Predicate to test the elements against.
+	 * @return Aggregator whose result is @c true if the predicate returned @c true for all elements.
+	 */
+	template<typename TPredicateFn>
+	constexpr AnyAll<TPredicateFn, true> all(TPredicateFn predicateFn) { return {predicateFn}; }
+
+}
@@ -0,0 +1,510 @@
+#pragma once
+
+#ifdef CXXITER_HAS_COROUTINE
+
+#include <coroutine>
+#include <exception>
+#include <optional>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <deque>
+#include <queue>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <tuple>
+#include <stdexcept>
+
+#include "Common.h"
+#include "util/Constraints.h"
+#include "util/CoroutineFrameAllocator.h"
+
+namespace CXXIter {
+
+	template<typename T = void> class Task;
+
+	/** @private */
+	namespace util {
+		/**
+		 * @brief Final awaiter of coroutines that are awaited by another coroutine, which transfers control back
+		 * to the awaiting coroutine (if any) when the coroutine completes.
+		 */
+		template<typename TPromise>
+		struct ContinuationAwaiter {
+			static bool await_ready() noexcept { return false; }
+			static std::coroutine_handle<> await_suspend(std::coroutine_handle<TPromise> self) noexcept {
+				if(std::coroutine_handle<> continuation = self.promise().continuation) { return continuation; }
+				return std::noop_coroutine();
+			}
+			static void await_resume() noexcept {}
+		};
+
+		/** @private */
+		template<typename TPromise>
+		struct TaskPromiseBase {
+			std::coroutine_handle<> continuation = {};
+			std::exception_ptr exceptionPtr;
+
+			static std::suspend_always initial_suspend() noexcept { return {}; }
+			static ContinuationAwaiter<TPromise> final_suspend() noexcept { return {}; }
+			void unhandled_exception() { exceptionPtr = std::current_exception(); }
+
+			static void* operator new(size_t size) { return CoroutineFrameAllocator::allocate(size); }
+			static void operator delete(void* ptr, size_t size) noexcept { CoroutineFrameAllocator::deallocate(ptr, size); }
+		};
+		/** @private */
+		template<typename T>
+		struct TaskPromise : public TaskPromiseBase<TaskPromise<T>> {
+			std::optional<T> result;
+
+			Task<T> get_return_object();
+			template<typename TValue>
+			requires std::is_constructible_v<T, TValue&&>
+			void return_value(TValue&& value) { result.emplace(std::forward<TValue>(value)); }
+		};
+		/** @private */
+		template<>
+		struct TaskPromise<void> : public TaskPromiseBase<TaskPromise<void>> {
+			Task<void> get_return_object();
+			static void return_void() noexcept {}
+		};
+	}
+
+	// ################################################################################################
+	// TASK
+	// ################################################################################################
+
+	/**
+	 * @brief Lazily started coroutine, producing a single result of type @p T, that can be awaited by other coroutines.
+	 * @details The coroutine is started when the task is first awaited (or passed to an executor such as
+	 * CXXIter::EventLoop), and transfers control back to the awaiting coroutine when it completes. Exceptions
+	 * thrown in the coroutine are rethrown from the @c co_await expression.
+	 * @tparam T Type of the result produced by the coroutine, or @c void.
+	 */
+	template<typename T>
+	class Task {
+		friend struct util::TaskPromise<T>;
+		friend class EventLoop;
+	public:
+		using promise_type = util::TaskPromise<T>;
+		using Handle = std::coroutine_handle<promise_type>;
+
+		Task() = default;
+		~Task() {
+			if(m_coroutine) { m_coroutine.destroy(); }
+		}
+		Task(const Task&) = delete;
+		Task& operator=(const Task&) = delete;
+		Task(Task&& other) noexcept : m_coroutine(std::exchange(other.m_coroutine, {})) {}
+		Task& operator=(Task&& other) noexcept {
+			if(this != &other) {
+				if(m_coroutine) { m_coroutine.destroy(); }
+				m_coroutine = std::exchange(other.m_coroutine, {});
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Whether the coroutine of this task ran to completion.
+		 */
+		bool done() const { return !m_coroutine || m_coroutine.done(); }
+
+		auto operator co_await() const noexcept {
+			struct Awaiter {
+				Handle coroutine;
+				bool await_ready() const noexcept { return !coroutine || coroutine.done(); }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+					coroutine.promise().continuation = awaiting;
+					return coroutine;
+				}
+				T await_resume() const { return Task::takeResult(coroutine); }
+			};
+			return Awaiter{m_coroutine};
+		}
+
+	private:
+		explicit Task(Handle coroutine) : m_coroutine(coroutine) {}
+
+		static T takeResult(Handle coroutine) {
+			if(coroutine.promise().exceptionPtr) {
+				std::rethrow_exception(coroutine.promise().exceptionPtr);
+			}
+			if constexpr(!std::is_void_v<T>) {
+				return std::move(*coroutine.promise().result);
+			}
+		}
+
+		Handle m_coroutine;
+	};
+
+	/** @private */
+	template<typename T>
+	inline Task<T> util::TaskPromise<T>::get_return_object() {
+		return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+	}
+	/** @private */
+	inline Task<void> util::TaskPromise<void>::get_return_object() {
+		return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+	}
+
+	// ################################################################################################
+	// EXECUTORS
+	// ################################################################################################
+
+	/**
+	 * @brief Concept for executors, that asynchronous CXXIter coroutines can be resumed on.
+	 * @details An executor has to provide a @c schedule() method, that resumes the given coroutine at some point
+	 * (on an arbitrary thread). It must be safe to call @c schedule() from any thread.
+	 */
+	template<typename TExecutor>
+	concept Executor = requires(TExecutor& executor, std::coroutine_handle<> handle) {
+		executor.schedule(handle);
+	};
+
+	/**
+	 * @brief Suspend the current coroutine, and continue it on the given @p executor.
+	 * @param executor Executor to resume the awaiting coroutine on.
+	 * @return Awaitable, that has to be passed to @c co_await.
+	 */
+	template<Executor TExecutor>
+	auto scheduleOn(TExecutor& executor) {
+		struct Awaiter {
+			TExecutor& executor;
+			static bool await_ready() noexcept { return false; }
+			void await_suspend(std::coroutine_handle<> awaiting) { executor.schedule(awaiting); }
+			static void await_resume() noexcept {}
+		};
+		return Awaiter{executor};
+	}
+
+	/**
+	 * @brief Simple single-threaded event loop, that is a CXXIter::Executor.
+	 * @details Coroutines scheduled on the event loop (from any thread) are resumed in FIFO order by the thread
+	 * calling run(). Coroutines can additionally suspend for a given time, using sleepFor(). This allows
+	 * interleaving many asynchronous pipelines on a single thread.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	CXXIter::EventLoop loop;
+	 * 	auto produce = [](CXXIter::EventLoop& loop) -> CXXIter::AsyncGenerator<int> {
+	 * 		for(int i = 0; i < 3; ++i) {
+	 * 			co_await loop.sleepFor(std::chrono::milliseconds(10)); // e.g. waiting for I/O
+	 * 			co_yield i;
+	 * 		}
+	 * 	};
+	 * 	auto consume = [](CXXIter::AsyncGenerator<int> input) -> CXXIter::Task<std::vector<int>> {
+	 * 		co_return co_await input.collectAsync();
+	 * 	};
+	 * 	std::vector<int> output = loop.runUntilComplete(consume(produce(loop)));
+	 * 	// output == {0, 1, 2}
+	 * @endcode
+	 */
+	class EventLoop {
+		using Clock = std::chrono::steady_clock;
+		struct Timer {
+			Clock::time_point due;
+			size_t sequence;
+			std::coroutine_handle<> handle;
+			bool operator>(const Timer& o) const { return std::tie(due, sequence) > std::tie(o.due, o.sequence); }
+		};
+
+		std::mutex mutex;
+		std::condition_variable wakeup;
+		std::deque<std::coroutine_handle<>> ready;
+		std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers;
+		size_t timerSequence = 0;
+		std::vector<Task<void>> spawned;
+
+		/** Take the next coroutine to resume, waiting for timers if necessary. Empty if no work is left. */
+		std::coroutine_handle<> takeNext() {
+			std::unique_lock lock(mutex);
+			while(true) {
+				const Clock::time_point now = Clock::now();
+				while(!timers.empty() && timers.top().due <= now) {
+					ready.push_back(timers.top().handle);
+					timers.pop();
+				}
+				if(!ready.empty()) {
+					std::coroutine_handle<> handle = ready.front();
+					ready.pop_front();
+					return handle;
+				}
+				if(timers.empty()) { return {}; }
+				wakeup.wait_until(lock, timers.top().due);
+			}
+		}
+
+	public:
+		EventLoop() = default;
+		EventLoop(const EventLoop&) = delete;
+		EventLoop& operator=(const EventLoop&) = delete;
+
+		/**
+		 * @brief Schedule the given coroutine @p handle to be resumed by this event loop. Thread-safe.
+		 */
+		void schedule(std::coroutine_handle<> handle) {
+			{
+				std::lock_guard lock(mutex);
+				ready.push_back(handle);
+			}
+			wakeup.notify_one();
+		}
+
+		/**
+		 * @brief Suspend the awaiting coroutine, and reschedule it at the end of this event loop's queue.
+		 * @details This allows other coroutines on the loop to make progress.
+		 */
+		auto yield() { return scheduleOn(*this); }
+
+		/**
+		 * @brief Suspend the awaiting coroutine for (at least) the given @p duration.
+		 */
+		template<typename TRep, typename TPeriod>
+		auto sleepFor(std::chrono::duration<TRep, TPeriod> duration) {
+			struct Awaiter {
+				EventLoop& loop;
+				Clock::time_point due;
+				static bool await_ready() noexcept { return false; }
+				void await_suspend(std::coroutine_handle<> awaiting) {
+					{
+						std::lock_guard lock(loop.mutex);
+						loop.timers.push(Timer{due, loop.timerSequence++, awaiting});
+					}
+					loop.wakeup.notify_one();
+				}
+				static void await_resume() noexcept {}
+			};
+			return Awaiter{*this, Clock::now() + std::chrono::duration_cast<Clock::duration>(duration)};
+		}
+
+		/**
+		 * @brief Start the given @p task on this event loop, without awaiting its result.
+		 * @details The task is owned by the event loop. Exceptions thrown by it are rethrown by run().
+		 */
+		void spawn(Task<void> task) {
+			std::coroutine_handle<> handle = task.m_coroutine;
+			spawned.push_back(std::move(task));
+			schedule(handle);
+		}
+
+		/**
+		 * @brief Resume scheduled coroutines on the calling thread, until no coroutine is scheduled and no timer is pending.
+		 * @details Afterwards, the first exception thrown by a spawned task (if any) is rethrown.
+		 */
+		void run() {
+			while(std::coroutine_handle<> handle = takeNext()) {
+				handle.resume();
+			}
+			std::vector<Task<void>> finished = std::exchange(spawned, {});
+			for(const Task<void>& task : finished) {
+				if(task.done()) { Task<void>::takeResult(task.m_coroutine); }
+			}
+		}
+
+		/**
+		 * @brief Start the given @p task on this event loop, and run() the loop until there is no more work.
+		 * @return The result of the given @p task.
+		 */
+		template<typename T>
+		T runUntilComplete(Task<T> task) {
+			schedule(task.m_coroutine);
+			run();
+			if(!task.done()) { throw std::logic_error("CXXIter::EventLoop::runUntilComplete(): task did not complete"); }
+			return Task<T>::takeResult(task.m_coroutine);
+		}
+	};
+
+	// ################################################################################################
+	// ASYNC GENERATOR
+	// ################################################################################################
+
+	/**
+	 * @brief Asynchronous variant of CXXIter::Generator, whose coroutine can @c co_await (e.g. for I/O), while
+	 * yielding an arbitrary amount of elements using @c co_yield.
+	 * @details The consumer pulls the items with <code>co_await generator.next()</code>, or consumes them using
+	 * forEachAsync() or collectAsync(), from within another coroutine. Instead of blocking, the consumer is suspended
+	 * while the generator waits, such that many pipelines can be interleaved on an executor like CXXIter::EventLoop.
+	 * The generator's coroutine is resumed on the thread of the consumer, and transfers control back directly
+	 * (using symmetric transfer) whenever it yields. Like CXXIter::Generator, yielded items are not copied into the
+	 * generator: rvalues are moved out of the coroutine frame, lvalues are copied once, and references are passed through.
+	 * @tparam T Type of the yielded items.
+	 *
+	 * Usage Example: See CXXIter::EventLoop
+	 */
+	template<typename T>
+	class AsyncGenerator {
+	public:
+		using value_type = T;
+		struct promise_type;
+		using Handle = std::coroutine_handle<promise_type>;
+
+		struct promise_type {
+		private:
+			friend class AsyncGenerator<T>;
+			using Value = std::remove_cvref_t<T>;
+			using ItemPtr = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, const Value*>;
+
+			/** Currently yielded item, that stays alive in the coroutine frame until it is resumed. */
+			ItemPtr currentItem = nullptr;
+			/** Whether the currently yielded item was yielded as rvalue, and can thus be moved out of. */
+			bool currentItemMovable = false;
+			std::exception_ptr exceptionPtr;
+
+			/** Awaiter that transfers control back to the consumer when an item was yielded. */
+			struct YieldAwaiter {
+				static bool await_ready() noexcept { return false; }
+				static std::coroutine_handle<> await_suspend(Handle self) noexcept { return self.promise().continuation; }
+				static void await_resume() noexcept {}
+			};
+			/** Awaiter owning an item of type T, constructed from a co_yield of another type. */
+			struct ConvertingAwaiter : public YieldAwaiter {
+				Value item;
+				std::coroutine_handle<> await_suspend(Handle self) noexcept {
+					self.promise().currentItem = std::addressof(item);
+					self.promise().currentItemMovable = true;
+					return YieldAwaiter::await_suspend(self);
+				}
+			};
+
+		public:
+			/** Consumer that is awaiting the next item. */
+			std::coroutine_handle<> continuation = {};
+
+			AsyncGenerator<T> get_return_object() {
+				return AsyncGenerator{Handle::from_promise(*this)};
+			}
+			static std::suspend_always initial_suspend() noexcept { return {}; }
+			static util::ContinuationAwaiter<promise_type> final_suspend() noexcept { return {}; }
+
+			YieldAwaiter yield_value(T item) noexcept requires std::is_reference_v<T> {
+				currentItem = std::addressof(item);
+				return {};
+			}
+			YieldAwaiter yield_value(const Value& item) noexcept requires (!std::is_reference_v<T> && std::copy_constructible<Value>) {
+				currentItem = std::addressof(item);
+				currentItemMovable = false;
+				return {};
+			}
+			YieldAwaiter yield_value(Value&& item) noexcept requires (!std::is_reference_v<T>) {
+				currentItem = std::addressof(item);
+				currentItemMovable = true;
+				return {};
+			}
+			template<typename TOther>
+			requires (!std::is_reference_v<T> && !std::is_same_v<std::remove_cvref_t<TOther>, Value> && std::is_constructible_v<Value, TOther&&>)
+			ConvertingAwaiter yield_value(TOther&& item) {
+				return ConvertingAwaiter{{}, Value(std::forward<TOther>(item))};
+			}
+
+			static void return_void() noexcept {}
+			void unhandled_exception() {
+				exceptionPtr = std::current_exception();
+			}
+
+			static void* operator new(size_t size) {
+				return util::CoroutineFrameAllocator::allocate(size);
+			}
+			static void operator delete(void* ptr, size_t size) noexcept {
+				util::CoroutineFrameAllocator::deallocate(ptr, size);
+			}
+		};
+
+		explicit AsyncGenerator(const Handle coroutine) : m_coroutine{coroutine} {}
+		AsyncGenerator() = default;
+		~AsyncGenerator() {
+			if(m_coroutine) { m_coroutine.destroy(); }
+		}
+		AsyncGenerator(const AsyncGenerator&) = delete;
+		AsyncGenerator& operator=(const AsyncGenerator&) = delete;
+		AsyncGenerator(AsyncGenerator&& other) noexcept : m_coroutine{std::exchange(other.m_coroutine, {})} {}
+		AsyncGenerator& operator=(AsyncGenerator&& other) noexcept {
+			if(this != &other) {
+				if(m_coroutine) { m_coroutine.destroy(); }
+				m_coroutine = std::exchange(other.m_coroutine, {});
+			}
+			return *this;
+		}
+
+		/**
+		 * @brief Asynchronously take the next item from this generator.
+		 * @return Awaitable resulting in the next item (if any) wrapped in CXXIter::IterValue.
+		 */
+		auto next() {
+			struct Awaiter {
+				Handle coroutine;
+				bool await_ready() const noexcept { return !coroutine || coroutine.done(); }
+				std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+					coroutine.promise().continuation = awaiting;
+					return coroutine;
+				}
+				IterValue<T> await_resume() const {
+					if(!coroutine) { return {}; }
+					promise_type& promise = coroutine.promise();
+					if(promise.exceptionPtr) {
+						std::rethrow_exception(std::exchange(promise.exceptionPtr, {}));
+					}
+					if(coroutine.done()) { return {}; }
+					if constexpr(std::is_reference_v<T>) {
+						return static_cast<T>(*promise.currentItem);
+					} else {
+						if constexpr(std::copy_constructible<typename promise_type::Value>) {
+							if(!promise.currentItemMovable) { return *promise.currentItem; }
+						}
+						// the item was yielded as non-const rvalue, so casting away the const is fine.
+						return std::move(*const_cast<typename promise_type::Value*>(promise.currentItem));
+					}
+				}
+			};
+			return Awaiter{m_coroutine};
+		}
+
+		/**
+		 * @brief Asynchronously call the given function @p useFn for each of this generator's items.
+		 * @details If @p useFn returns a CXXIter::Task, it is awaited before the next item is taken.
+		 * This generator has to outlive the returned task.
+		 * @param useFn Function called for each of this generator's items.
+		 * @return Task that completes after all items were consumed.
+		 */
+		template<typename TUseFn>
+		Task<void> forEachAsync(TUseFn useFn) {
+			while(true) {
+				IterValue<T> item = co_await next();
+				if(!item.has_value()) { co_return; }
+				if constexpr(util::is_template_instance_v<std::invoke_result_t<TUseFn&, T>, Task>) {
+					co_await useFn(std::forward<T>(item.value()));
+				} else {
+					useFn(std::forward<T>(item.value()));
+				}
+			}
+		}
+
+		/**
+		 * @brief Asynchronously collect all of this generator's items into a container of type @p TContainer.
+		 * @details This generator has to outlive the returned task.
+		 * @tparam TContainer Type template of the container to collect into, such as @c std::vector or @c std::set.
+		 * @tparam TContainerArgs Optional additional template parameters of the container.
+		 * @return Task resulting in the container with all items.
+		 */
+		template<template <typename...> typename TContainer = std::vector, typename... TContainerArgs>
+		Task<TContainer<std::remove_cvref_t<T>, TContainerArgs...>> collectAsync() {
+			using TResult = TContainer<std::remove_cvref_t<T>, TContainerArgs...>;
+			TResult container;
+			while(true) {
+				IterValue<T> item = co_await next();
+				if(!item.has_value()) { co_return container; }
+				if constexpr(util::BackInsertableContainer<TResult, std::remove_cvref_t<T>>) {
+					container.push_back(std::forward<T>(item.value()));
+				} else {
+					container.insert(std::forward<T>(item.value()));
+				}
+			}
+		}
+
+	private:
+		Handle m_coroutine;
+	};
+
+}
+
+#endif
@@ -0,0 +1,201 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// CHANNEL
+	// ################################################################################################
+
+	/**
+	 * @brief Bounded multi-producer / multi-consumer channel, to pass elements between threads.
+	 * @details The channel is implemented as lock-free ring buffer, where each slot carries a sequence number
+	 * that tells producers and consumers whether it is free or filled (Dmitry Vyukov's bounded MPMC queue).
+	 * Producers and consumers thus only contend on one atomic counter each. The blocking send() and receive()
+	 * spin briefly, and then block using @c std::atomic::wait() until the other side made progress.
+	 *
+	 * A channel can be closed using close(). Afterwards, sending fails, while receivers can still drain the
+	 * remaining elements - after which receive() returns an empty optional. This allows to feed a CXXIter pipeline
+	 * from any number of threads (see CXXIter::fromChannel()), or to fan a pipeline out to multiple consumers
+	 * (see CXXIter::IterApi::sendTo()).
+	 * @tparam T Type of the elements passed through the channel.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	CXXIter::Channel<std::string> channel(1024);
+	 * 	std::vector<std::thread> producers;
+	 * 	for(size_t i = 0; i < 4; ++i) {
+	 * 		producers.emplace_back([&channel, i]() {
+	 * 			CXXIter::range<size_t>(0, 99).map([i](size_t j) { return std::to_string(i * 100 + j); }).sendTo(channel);
+	 * 		});
+	 * 	}
+	 * 	std::thread closer([&]() {
+	 * 		for(std::thread& producer : producers) { producer.join(); }
+	 * 		channel.close();
+	 * 	});
+	 * 	size_t output = CXXIter::fromChannel(channel).count();
+	 * 	closer.join();
+	 * 	// output == 400
+	 * @endcode
+	 */
+	template<typename T>
+	class Channel {
+		static constexpr size_t CACHE_LINE_SIZE = 64;
+		static constexpr size_t SPIN_CNT = 64;
+
+		struct Slot {
+			std::atomic<size_t> sequence;
+			alignas(T) std::byte storage[sizeof(T)];
+
+			T* item() { return std::launder(reinterpret_cast<T*>(storage)); }
+		};
+
+		const size_t mask;
+		std::unique_ptr<Slot[]> slots;
+
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> sendPos = 0;
+		alignas(CACHE_LINE_SIZE) std::atomic<size_t> receivePos = 0;
+		/** Incremented whenever an element was sent (or the channel was closed), to wake up blocked receivers. */
+		alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> sentSignal = 0;
+		/** Incremented whenever an element was received (or the channel was closed), to wake up blocked senders. */
+		alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> receivedSignal = 0;
+		std::atomic<bool> closed = false;
+
+		template<typename TItem>
+		bool trySendImpl(TItem&& item) {
+			size_t pos = sendPos.load(std::memory_order_relaxed);
+			while(true) {
+				Slot& slot = slots[pos & mask];
+				const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+				if(diff == 0) {
+					if(sendPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						::new(slot.storage) T(std::forward<TItem>(item));
+						slot.sequence.store(pos + 1, std::memory_order_release);
+						sentSignal.fetch_add(1, std::memory_order_release);
+						sentSignal.notify_all();
+						return true;
+					}
+				} else if(diff < 0) {
+					return false; // full
+				} else {
+					pos = sendPos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		template<typename TItem>
+		bool sendImpl(TItem&& item) {
+			for(size_t i = 0; true; ++i) {
+				if(closed.load(std::memory_order_acquire)) [[unlikely]] { return false; }
+				const uint32_t signal = receivedSignal.load(std::memory_order_acquire);
+				if(trySendImpl(std::forward<TItem>(item))) { return true; }
+				if(i >= SPIN_CNT) { receivedSignal.wait(signal, std::memory_order_acquire); }
+			}
+		}
+
+	public:
+		/**
+		 * @brief Create a new channel, that can hold up to @p capacity elements (rounded up to the next power of two).
+		 */
+		explicit Channel(size_t capacity) : mask(std::bit_ceil(std::max<size_t>(capacity, 2)) - 1), slots(new Slot[mask + 1]) {
+			for(size_t i = 0; i <= mask; ++i) {
+				slots[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+		~Channel() {
+			while(tryReceive().has_value()) {}
+		}
+		Channel(const Channel&) = delete;
+		Channel& operator=(const Channel&) = delete;
+
+		/**
+		 * @brief Maximum amount of elements that the channel can hold.
+		 */
+		size_t capacity() const { return mask + 1; }
+
+		/**
+		 * @brief Close this channel.
+		 * @details Subsequent sends fail, and blocked senders return. Receivers can still drain the remaining elements,
+		 * after which they receive an empty optional. Elements that are sent concurrently to closing the channel may
+		 * or may not be delivered.
+		 */
+		void close() {
+			closed.store(true, std::memory_order_release);
+			sentSignal.fetch_add(1, std::memory_order_release);
+			sentSignal.notify_all();
+			receivedSignal.fetch_add(1, std::memory_order_release);
+			receivedSignal.notify_all();
+		}
+		/**
+		 * @brief Whether this channel was closed.
+		 */
+		bool isClosed() const { return closed.load(std::memory_order_acquire); }
+
+		/**
+		 * @brief Send the given @p item into this channel, if it is not full.
+		 * @return @c true if the item was sent, @c false if the channel is full or closed (@p item is left untouched).
+		 */
+		bool trySend(const T& item) { return !isClosed() && trySendImpl(item); }
+		/** @copydoc trySend(const T&) */
+		bool trySend(T&& item) { return !isClosed() && trySendImpl(std::move(item)); }
+
+		/**
+		 * @brief Send the given @p item into this channel, blocking while the channel is full.
+		 * @return @c true if the item was sent, @c false if the channel was closed (@p item is left untouched).
+		 */
+		bool send(const T& item) { return sendImpl(item); }
+		/** @copydoc send(const T&) */
+		bool send(T&& item) { return sendImpl(std::move(item)); }
+
+		/**
+		 * @brief Take the next element from this channel, if there is one.
+		 * @return The next element, or an empty optional if the channel is currently empty.
+		 */
+		std::optional<T> tryReceive() {
+			size_t pos = receivePos.load(std::memory_order_relaxed);
+			while(true) {
+				Slot& slot = slots[pos & mask];
+				const size_t sequence = slot.sequence.load(std::memory_order_acquire);
+				const intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1);
+				if(diff == 0) {
+					if(receivePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+						std::optional<T> result(std::move(*slot.item()));
+						std::destroy_at(slot.item());
+						slot.sequence.store(pos + mask + 1, std::memory_order_release);
+						receivedSignal.fetch_add(1, std::memory_order_release);
+						receivedSignal.notify_all();
+						return result;
+					}
+				} else if(diff < 0) {
+					return {}; // empty
+				} else {
+					pos = receivePos.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		 * @brief Take the next element from this channel, blocking while the channel is empty.
+		 * @return The next element, or an empty optional if the channel was closed and all elements were received.
+		 */
+		std::optional<T> receive() {
+			for(size_t i = 0; true; ++i) {
+				const uint32_t signal = sentSignal.load(std::memory_order_acquire);
+				if(std::optional<T> item = tryReceive()) { return item; }
+				if(isClosed()) [[unlikely]] { return tryReceive(); }
+				if(i >= SPIN_CNT) { sentSignal.wait(signal, std::memory_order_acquire); }
+			}
+		}
+	};
+
+}
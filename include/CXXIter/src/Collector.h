@@ -1,6 +1,7 @@
 #pragma once
 
 #include <tuple>
+#include <iterator>
 #include <type_traits>
 
 #include "Common.h"
@@ -23,7 +24,21 @@ namespace CXXIter {
 			if constexpr(util::ReservableContainer<TContainer>) {
 				container.reserve( container.size() + input.sizeHint().expectedResultSize() );
 			}
-			input.forEach([&container](Item&& item) { container.push_back( std::forward<Item>(item) ); });
+			if constexpr(CXXIterSegmentedIterator<TChainInput>
+					&& util::RangeInsertableContainer<TContainer, typename trait::SegmentedIterator<TChainInput>::Segment::iterator>) {
+				// append each contiguous segment with one range-insert
+				while(true) {
+					auto segment = trait::SegmentedIterator<TChainInput>::nextSegment(input);
+					if(segment.empty()) [[unlikely]] { return; }
+					if constexpr(std::is_reference_v<Item>) {
+						container.insert(container.end(), segment.begin(), segment.end());
+					} else {
+						container.insert(container.end(), std::make_move_iterator(segment.begin()), std::make_move_iterator(segment.end()));
+					}
+				}
+			} else {
+				input.forEach([&container](Item&& item) { container.push_back( std::forward<Item>(item) ); });
+			}
 		}
 	};
 	/** @private */
@@ -55,6 +70,36 @@ namespace CXXIter {
 	};
 
 
+	// ################################################################################################
+	// ITEM COLLECTOR
+	// ################################################################################################
+	/**
+	 * @private
+	 * @brief Reserve space for @p additional more items in the given @p container (if supported).
+	 */
+	template<typename TContainer>
+	static constexpr inline void reserveAdditional(TContainer& container, size_t additional) {
+		if constexpr(util::ReservableContainer<TContainer>) {
+			container.reserve( container.size() + additional );
+		}
+	}
+	/**
+	 * @private
+	 * @brief Append a single @p item to the given @p container. Uses @c push_back() where
+	 * available, and @c insert() otherwise.
+	 */
+	template<typename TContainer, typename TItem>
+	requires util::BackInsertableContainer<TContainer, std::remove_cvref_t<TItem>>
+		|| util::InsertableContainer<TContainer, std::remove_cvref_t<TItem>>
+	static constexpr inline void collectItemInto(TContainer& container, TItem&& item) {
+		if constexpr(util::BackInsertableContainer<TContainer, std::remove_cvref_t<TItem>>) {
+			container.push_back( std::forward<TItem>(item) );
+		} else {
+			container.insert( std::forward<TItem>(item) );
+		}
+	}
+
+
 	// ################################################################################################
 	// COLLECTOR
 	// ################################################################################################
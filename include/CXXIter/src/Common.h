@@ -97,6 +97,13 @@ namespace CXXIter {
 		{trait::ContiguousMemoryIterator<T>::currentPtr(self)} -> std::same_as<typename trait::ContiguousMemoryIterator<T>::ItemPtr>;
 	};
 
+	template<typename T>
+	concept CXXIterSegmentedIterator = CXXIterIterator<T>
+		&& requires(typename trait::Iterator<T>::Self& self) {
+		typename trait::SegmentedIterator<T>::Segment;
+		{trait::SegmentedIterator<T>::nextSegment(self)} -> std::same_as<typename trait::SegmentedIterator<T>::Segment>;
+	};
+
 	template<CXXIterIterator TSelf> class IterApi;
 
 }
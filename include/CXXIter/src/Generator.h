@@ -3,8 +3,13 @@
 #ifdef CXXITER_HAS_COROUTINE
 
 #include <coroutine>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <utility>
 
 #include "Common.h"
+#include "util/CoroutineFrameAllocator.h"
 
 namespace CXXIter {
 
@@ -16,7 +21,28 @@ namespace CXXIter {
 	 * @brief Generator that C++20 coroutines passed to CXXIter::IterApi::generateFrom() have to return.
 	 * This generator supports exceptions, co_yield for producing an arbitrary amount of elements, and can
 	 * take references as results from coroutines - as long as they live long enough until used.
+	 *
+	 * Yielded items are not copied into the generator. Instead, it keeps a pointer to the yielded item, which lives
+	 * in the coroutine frame until the coroutine is resumed. Items yielded as rvalue are moved out of it (which allows
+	 * move-only types), lvalues are copied once - or passed through without any copy, if @p T is a reference type.
+	 *
+	 * A coroutine can delegate to another generator of the same type with <code>co_yield CXXIter::elementsOf(child)</code>.
+	 * The child's items are then passed through without being re-yielded by the delegating coroutine: resuming the
+	 * generator resumes the innermost active coroutine directly (using symmetric transfer), so the cost per item does
+	 * not grow with the nesting depth. Exceptions thrown in the child propagate out of the @c co_yield expression.
+	 *
+	 * When producing items in blocks, <code>co_yield CXXIter::elementsOf(span)</code> yields a whole span at once, such
+	 * that the coroutine is only resumed once per block. For generators of references, iterating such a generator
+	 * with CXXIter then walks through each block as contiguous segment (see CXXIter::trait::SegmentedIterator).
+	 *
+	 * The coroutine frames are allocated from a thread-local pool (see CXXIter::util::CoroutineFramePool), such
+	 * that repeatedly creating generators of the same coroutine does not allocate after the first one. Alternatively,
+	 * frames can be allocated from a user-supplied allocator, using CXXIter::GeneratorAllocatorScope.
 	 */
+	template<typename T> class Generator;
+	template<typename T> struct ElementsOf;
+	template<typename TElement> struct ElementsOfSpan;
+
 	template<typename T>
 	class Generator {
 	public:
@@ -25,22 +51,144 @@ namespace CXXIter {
 		using Handle = std::coroutine_handle<promise_type>;
 
 		struct promise_type {
-			IterValue<T> currentItem;
+		private:
+			friend class Generator<T>;
+			using Value = std::remove_cvref_t<T>;
+			using ItemPtr = std::conditional_t<std::is_reference_v<T>, std::remove_reference_t<T>*, const Value*>;
+
+			/**
+			 * Range of the currently yielded items, that were not yet taken by the consumer. This is a single item
+			 * for normal yields, and a batch of items for CXXIter::elementsOf() yields of a span. The items
+			 * themselves live in the coroutine frame, and stay alive until the coroutine is resumed again.
+			 */
+			ItemPtr currentItem = nullptr;
+			ItemPtr currentEnd = nullptr;
+			/** Whether the currently yielded item was yielded as rvalue, and can thus be moved out of. */
+			bool currentItemMovable = false;
 			std::exception_ptr exceptionPtr;
 
+			/**
+			 * Promise of the outermost coroutine, that the Generator was returned from. Yielded items are always
+			 * stored there, such that nested coroutines can yield directly to the consumer.
+			 */
+			promise_type* root = this;
+			/** Innermost coroutine that is currently active (only maintained on the root). */
+			Handle leaf = Handle::from_promise(*this);
+			/** Coroutine delegating to this one using CXXIter::elementsOf(), if any. */
+			Handle parent = {};
+
+			/** Awaiter that transfers control to the parent coroutine (if any) when this one completes. */
+			struct FinalAwaiter {
+				static bool await_ready() noexcept { return false; }
+				static std::coroutine_handle<> await_suspend(Handle self) noexcept {
+					promise_type& promise = self.promise();
+					if(promise.parent) {
+						promise.root->leaf = promise.parent;
+						return promise.parent;
+					}
+					return std::noop_coroutine();
+				}
+				static void await_resume() noexcept {}
+			};
+
+			/** Awaiter owning a child coroutine, that control is transferred to for a CXXIter::elementsOf() yield. */
+			struct DelegatingAwaiter {
+				Handle child;
+
+				explicit DelegatingAwaiter(Handle child) : child(child) {}
+				DelegatingAwaiter(const DelegatingAwaiter&) = delete;
+				DelegatingAwaiter& operator=(const DelegatingAwaiter&) = delete;
+				~DelegatingAwaiter() {
+					if(child) { child.destroy(); }
+				}
+
+				bool await_ready() const noexcept { return !child; }
+				std::coroutine_handle<> await_suspend(Handle self) noexcept {
+					promise_type& childPromise = child.promise();
+					childPromise.root = self.promise().root;
+					childPromise.parent = self;
+					childPromise.root->leaf = child;
+					return child;
+				}
+				void await_resume() const {
+					if(child && child.promise().exceptionPtr) {
+						std::rethrow_exception(child.promise().exceptionPtr);
+					}
+				}
+			};
+
+			/** Awaiter owning an item of type T, constructed from a co_yield of another type. */
+			struct ConvertingAwaiter : public std::suspend_always {
+				Value item;
+				promise_type& promise;
+				void await_suspend(std::coroutine_handle<>) noexcept {
+					promise.root->setCurrentItem(std::addressof(item), true);
+				}
+			};
+
+			/** Awaiter for a CXXIter::elementsOf() yield of a span, that only suspends for non-empty spans. */
+			struct BatchAwaiter {
+				bool empty;
+				bool await_ready() const noexcept { return empty; }
+				static void await_suspend(std::coroutine_handle<>) noexcept {}
+				static void await_resume() noexcept {}
+			};
+
+			void setCurrentItem(ItemPtr item, bool movable) noexcept {
+				currentItem = item;
+				currentEnd = item + 1;
+				currentItemMovable = movable;
+			}
+
+		public:
 			Generator<T> get_return_object() {
 				return Generator{Handle::from_promise(*this)};
 			}
 			static std::suspend_always initial_suspend() noexcept { return {}; }
-			static std::suspend_always final_suspend() noexcept { return {}; }
-			std::suspend_always yield_value(T value) noexcept {
-				currentItem = value;
+			static FinalAwaiter final_suspend() noexcept { return {}; }
+
+			std::suspend_always yield_value(T item) noexcept requires std::is_reference_v<T> {
+				root->setCurrentItem(std::addressof(item), false);
+				return {};
+			}
+			std::suspend_always yield_value(const Value& item) noexcept requires (!std::is_reference_v<T> && std::copy_constructible<Value>) {
+				root->setCurrentItem(std::addressof(item), false);
+				return {};
+			}
+			std::suspend_always yield_value(Value&& item) noexcept requires (!std::is_reference_v<T>) {
+				root->setCurrentItem(std::addressof(item), true);
 				return {};
 			}
+			DelegatingAwaiter yield_value(ElementsOf<T> elements) noexcept {
+				return DelegatingAwaiter(std::exchange(elements.generator.m_coroutine, {}));
+			}
+			// batch items are never moved out of, so generators of values need to be able to copy them
+			template<typename TElement>
+			requires (std::is_same_v<std::remove_const_t<TElement>, Value> && std::is_convertible_v<TElement*, ItemPtr>
+					&& (std::is_reference_v<T> || std::copy_constructible<Value>))
+			BatchAwaiter yield_value(ElementsOfSpan<TElement> elements) noexcept {
+				root->currentItem = elements.items.data();
+				root->currentEnd = elements.items.data() + elements.items.size();
+				root->currentItemMovable = false;
+				return BatchAwaiter{elements.items.empty()};
+			}
+			template<typename TOther>
+			requires (!std::is_reference_v<T> && !std::is_same_v<std::remove_cvref_t<TOther>, Value> && std::is_constructible_v<Value, TOther&&>)
+			ConvertingAwaiter yield_value(TOther&& item) {
+				return ConvertingAwaiter{{}, Value(std::forward<TOther>(item)), *this};
+			}
 
+			static void return_void() noexcept {}
 			void unhandled_exception() {
 				exceptionPtr = std::current_exception();
 			}
+
+			static void* operator new(size_t size) {
+				return util::CoroutineFrameAllocator::allocate(size);
+			}
+			static void operator delete(void* ptr, size_t size) noexcept {
+				util::CoroutineFrameAllocator::deallocate(ptr, size);
+			}
 		};
 
 		explicit Generator(const Handle coroutine) : m_coroutine{coroutine} {}
@@ -54,37 +202,179 @@ namespace CXXIter {
 		Generator(const Generator&) = delete;
 		Generator& operator=(const Generator&) = delete;
 
-		Generator(Generator&& other) noexcept : m_coroutine{other.m_coroutine} {
-			other.m_coroutine = {};
-		}
+		Generator(Generator&& other) noexcept : m_coroutine{std::exchange(other.m_coroutine, {})} {}
 		Generator& operator=(Generator&& other) noexcept {
-			m_coroutine = other;
-			other.m_coroutine = {};
+			if(this != &other) {
+				if(m_coroutine) { m_coroutine.destroy(); }
+				m_coroutine = std::exchange(other.m_coroutine, {});
+			}
 			return *this;
 		}
 
+		/**
+		 * @brief Take the next item from this generator, resuming the coroutine if all previously yielded items were taken.
+		 * @details Items yielded as rvalue are moved out of the coroutine frame, items yielded as lvalue are copied
+		 * (or passed through as reference, if @p T is a reference type). No intermediate copies are made.
+		 */
 		IterValue<T> next() {
-			if(m_coroutine && !m_coroutine.promise().currentItem.has_value()) {
-				m_coroutine.resume();
-				if(m_coroutine.promise().exceptionPtr) {
-					std::rethrow_exception(m_coroutine.promise().exceptionPtr);
+			if(!m_coroutine) { return {}; }
+			promise_type& promise = m_coroutine.promise();
+			if(promise.currentItem == promise.currentEnd && !resume()) { return {}; }
+			auto item = promise.currentItem++;
+			if constexpr(std::is_reference_v<T>) {
+				return static_cast<T>(*item);
+			} else {
+				if constexpr(std::copy_constructible<typename promise_type::Value>) {
+					if(!promise.currentItemMovable) { return *item; }
 				}
+				// the item was yielded as non-const rvalue, so casting away the const is fine.
+				return std::move(*const_cast<typename promise_type::Value*>(item));
+			}
+		}
+
+		/**
+		 * @brief Take all remaining items of the current batch from this generator, resuming the coroutine if all
+		 * previously yielded items were taken.
+		 * @details This passes through all items yielded with a single <code>co_yield CXXIter::elementsOf(span)</code>
+		 * at once, while normal yields result in a batch of one item. The returned span stays valid until the
+		 * generator is advanced again. Only available for generators of references, since the items are not copied.
+		 * @return The next batch of items, or an empty span if the coroutine finished.
+		 */
+		std::span<std::remove_reference_t<T>> nextBatch() requires std::is_reference_v<T> {
+			if(!m_coroutine) { return {}; }
+			promise_type& promise = m_coroutine.promise();
+			if(promise.currentItem == promise.currentEnd && !resume()) { return {}; }
+			return std::span<std::remove_reference_t<T>>(std::exchange(promise.currentItem, promise.currentEnd), promise.currentEnd);
+		}
+
+	private:
+		/** Resume the innermost active coroutine until it yields, returns @c false if the generator finished. */
+		bool resume() {
+			promise_type& promise = m_coroutine.promise();
+			promise.leaf.resume();
+			if(promise.exceptionPtr) {
+				std::rethrow_exception(promise.exceptionPtr);
 			}
 			if(m_coroutine.done()) {
 				m_coroutine.destroy();
 				m_coroutine = {};
-				return {};
+				return false;
 			}
-			// Depends on IterValue<T>'s guarantee, to clear the moved-out-of IterValue
-			// irrespecting on the type of T. (std::optional<T> doesn't!)
-			//TODO: unit-test for IterValue?
-			return std::move(m_coroutine.promise().currentItem);
+			return true;
 		}
 
 	private:
 		Handle m_coroutine;
 	};
 
+	/**
+	 * @brief Wrapper around a CXXIter::Generator, that a coroutine returning a generator of the same type can
+	 * @c co_yield to pass all items of the wrapped generator through. Constructed using CXXIter::elementsOf().
+	 */
+	template<typename T>
+	struct ElementsOf {
+		Generator<T> generator;
+	};
+
+	/**
+	 * @brief Delegate to the given @p generator from within a coroutine returning a CXXIter::Generator of the same type.
+	 * @details All items of @p generator are passed through to the consumer, without being re-yielded by the
+	 * delegating coroutine. @p generator must not have been advanced before.
+	 * @param generator Generator whose items to pass through.
+	 * @return Wrapper that has to be passed to @c co_yield.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	struct Node { int value; std::vector<Node> children; };
+	 * 	CXXIter::Generator<int> walk(const Node& node) {
+	 * 		co_yield node.value;
+	 * 		for(const Node& child : node.children) {
+	 * 			co_yield CXXIter::elementsOf(walk(child));
+	 * 		}
+	 * 	}
+	 * @endcode
+	 */
+	template<typename T>
+	ElementsOf<T> elementsOf(Generator<T>&& generator) {
+		return ElementsOf<T>{std::move(generator)};
+	}
+
+	/**
+	 * @brief Wrapper around a span, that a coroutine returning a CXXIter::Generator of the span's element type
+	 * can @c co_yield to yield all of the span's items at once. Constructed using CXXIter::elementsOf().
+	 */
+	template<typename TElement>
+	struct ElementsOfSpan {
+		std::span<TElement> items;
+	};
+
+	/**
+	 * @brief Yield all items of the given @p items span with a single @c co_yield, from within a coroutine returning
+	 * a CXXIter::Generator of the span's element type.
+	 * @details The coroutine is only suspended and resumed once for the whole span, while the consumer takes the
+	 * items one by one (or all at once, using CXXIter::Generator::nextBatch()). The span's items have to stay alive
+	 * until the coroutine is resumed, and are copied out by generators of values, or passed through as reference
+	 * by generators of references. Generators of move-only values thus can not yield spans. Empty spans do not
+	 * suspend the coroutine.
+	 * @param items Span of items to yield.
+	 * @return Wrapper that has to be passed to @c co_yield.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	CXXIter::Generator<const Record&> readRecords(std::istream& input) {
+	 * 		std::vector<Record> block;
+	 * 		while(readBlock(input, block)) {
+	 * 			co_yield CXXIter::elementsOf(std::span(block));
+	 * 		}
+	 * 	}
+	 * @endcode
+	 */
+	template<typename TElement>
+	ElementsOfSpan<TElement> elementsOf(std::span<TElement> items) {
+		return ElementsOfSpan<TElement>{items};
+	}
+	/**
+	 * @brief Yield all items of the given contiguous @p range with a single @c co_yield.
+	 * @see elementsOf(std::span<TElement>)
+	 */
+	template<std::ranges::contiguous_range TRange>
+	requires (std::ranges::sized_range<TRange> && std::is_lvalue_reference_v<std::ranges::range_reference_t<TRange>>)
+	auto elementsOf(TRange& range) {
+		return elementsOf(std::span(std::ranges::data(range), std::ranges::size(range)));
+	}
+
+	/**
+	 * @brief RAII guard that installs the given allocator for all coroutine frames of CXXIter::Generator, that are
+	 * created on the current thread during the lifetime of the guard.
+	 * @details This allows e.g. to allocate the frames from an arena. A copy of the allocator is stored alongside each
+	 * frame and used to deallocate it, so generators can outlive the guard. Guards can be nested, in which case the
+	 * innermost one is used. Without a guard, frames are allocated from a thread-local pool.
+	 * @tparam TAlloc Type of the allocator. It is rebound to allocate blocks of the default @c new alignment.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	ArenaAllocator<std::byte> arena(...);
+	 * 	CXXIter::GeneratorAllocatorScope scope(arena);
+	 * 	std::vector<std::string> tokens = CXXIter::from(lines)
+	 * 		.generateFrom([](const std::string& line) -> CXXIter::Generator<std::string> { ... })
+	 * 		.collect<std::vector>();
+	 * @endcode
+	 */
+	template<typename TAlloc>
+	class GeneratorAllocatorScope {
+		TAlloc alloc;
+		util::CoroutineFrameAllocator::Scope scope;
+	public:
+		explicit GeneratorAllocatorScope(const TAlloc& alloc) : alloc(alloc), scope(util::CoroutineFrameAllocator::makeScope(this->alloc)) {
+			scope.previous = std::exchange(util::CoroutineFrameAllocator::currentScope(), &scope);
+		}
+		~GeneratorAllocatorScope() {
+			util::CoroutineFrameAllocator::currentScope() = scope.previous;
+		}
+		GeneratorAllocatorScope(const GeneratorAllocatorScope&) = delete;
+		GeneratorAllocatorScope& operator=(const GeneratorAllocatorScope&) = delete;
+	};
+
 	template<typename T>
 	concept GeneratorFunction = (std::invocable<T> && util::is_template_instance_v<std::invoke_result_t<T>, Generator>);
 }
@@ -1,10 +1,14 @@
 #pragma once
 
 #include <tuple>
+#include <array>
 #include <cstdlib>
 #include <optional>
+#include <string_view>
 #include <unordered_set>
 
+#include "util/NumberParsing.h"
+
 /**
  * @brief Namespace that contains helper functions providing commonly required functionality
  * when working with CXXIter.
@@ -158,4 +162,138 @@ namespace CXXIter::fn {
 		return filterIsOneOf<TItem>([](const auto& item) { return item; }, acceptedValues);
 	}
 
+	// ################################################################################################
+	// NUMBER PARSING
+	// ################################################################################################
+
+	/**
+	 * @brief Helper to construct a map() lambda that parses each element (anything convertible to @c std::string_view)
+	 * as number of type @p TNumber, using @c std::from_chars.
+	 * @details In contrast to e.g. @c std::stoi, this does not require a @c std::string (and thus no allocation) and
+	 * does not depend on the locale. The whole element has to be a valid number, surrounding whitespace is not
+	 * accepted.
+	 * @tparam TNumber Integral or floating-point type to parse the elements as.
+	 * @return Lambda that parses a given element as @p TNumber.
+	 * @throws std::invalid_argument (when called) if the element is not a valid number.
+	 * @throws std::out_of_range (when called) if the number does not fit into @p TNumber.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "1,22,333";
+	 * 	int output = CXXIter::split(input, ',')
+	 * 		.map(CXXIter::fn::parse<int>())
+	 * 		.sum();
+	 * 	// output == 356
+	 * @endcode
+	 */
+	template<typename TNumber>
+	requires std::is_arithmetic_v<TNumber>
+	auto parse() {
+		return [](const auto& item) -> TNumber {
+			const std::string_view input = util::asStringView(item);
+			TNumber result;
+			if(std::errc ec = util::parseNumber(input, result); ec != std::errc()) [[unlikely]] {
+				util::throwParseError(ec, input);
+			}
+			return result;
+		};
+	}
+
+	/**
+	 * @brief Helper to construct a filterMap() lambda that parses each element (anything convertible to @c std::string_view)
+	 * as number of type @p TNumber, using @c std::from_chars.
+	 * @details This is the non-throwing variant of parse(). Elements that are not a valid number, or whose value does
+	 * not fit into @p TNumber, yield an empty @c std::optional - and are thus dropped when used with filterMap().
+	 * @tparam TNumber Integral or floating-point type to parse the elements as.
+	 * @return Lambda that parses a given element as @p TNumber, returning @c std::optional<TNumber>.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "1,x,333,";
+	 * 	std::vector<int> output = CXXIter::split(input, ',')
+	 * 		.filterMap(CXXIter::fn::tryParse<int>())
+	 * 		.collect<std::vector>();
+	 * 	// output == {1, 333}
+	 * @endcode
+	 */
+	template<typename TNumber>
+	requires std::is_arithmetic_v<TNumber>
+	auto tryParse() {
+		return [](const auto& item) -> std::optional<TNumber> {
+			TNumber result;
+			if(util::parseNumber(util::asStringView(item), result) != std::errc()) [[unlikely]] { return {}; }
+			return result;
+		};
+	}
+
+	/**
+	 * @brief Helper to construct a map() lambda that parses each element (anything convertible to @c std::string_view),
+	 * consisting of exactly @p DIGITS decimal digits, as integer of type @p TNumber.
+	 * @details This is a fast-path for fixed-width decimal fields (such as zero-padded ids or dates), which parses
+	 * 8 digits at once using SWAR (SIMD within a register). Signs, whitespace or other characters are not accepted.
+	 * @tparam TNumber Integral type to parse the elements as.
+	 * @tparam DIGITS Exact amount of digits of each element (1 - 19).
+	 * @return Lambda that parses a given element as @p TNumber.
+	 * @throws std::invalid_argument (when called) if the element does not consist of exactly @p DIGITS digits,
+	 * or its value does not fit into @p TNumber.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "20240131,20231224";
+	 * 	std::vector<uint32_t> output = CXXIter::split(input, ',')
+	 * 		.map(CXXIter::fn::parseFixedWidth<uint32_t, 8>())
+	 * 		.collect<std::vector>();
+	 * 	// output == {20240131, 20231224}
+	 * @endcode
+	 */
+	template<std::integral TNumber, size_t DIGITS>
+	requires (DIGITS > 0 && DIGITS <= 19)
+	auto parseFixedWidth() {
+		return [](const auto& item) -> TNumber {
+			const std::string_view input = util::asStringView(item);
+			std::optional<TNumber> result = util::parseFixedWidth<TNumber, DIGITS>(input);
+			if(!result.has_value()) [[unlikely]] { util::throwParseError(std::errc::invalid_argument, input); }
+			return result.value();
+		};
+	}
+
+	/**
+	 * @brief Helper to construct a map() lambda that parses all elements of a chunk (as produced by chunkedExact())
+	 * at once, as numbers of type @p TNumber.
+	 * @details The chunk's elements can be anything convertible to @c std::string_view (or reference wrappers to that).
+	 * If @p DIGITS is @c 0, each element is parsed using @c std::from_chars (see parse()), otherwise each element has
+	 * to consist of exactly @p DIGITS decimal digits, and the SWAR fast-path is used (see parseFixedWidth()).
+	 * @tparam TNumber Type to parse the elements as.
+	 * @tparam DIGITS Exact amount of digits of each element, or @c 0 for arbitrary numbers.
+	 * @return Lambda that parses a given chunk into a @c std::array<TNumber, N> of the same size.
+	 * @throws std::invalid_argument (when called) if an element is not a valid number.
+	 * @throws std::out_of_range (when called) if a number does not fit into @p TNumber.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	std::string input = "1,2,3,4,5,6";
+	 * 	std::vector<std::array<int, 3>> output = CXXIter::split(input, ',')
+	 * 		.chunkedExact<3>()
+	 * 		.map(CXXIter::fn::parseChunk<int>())
+	 * 		.collect<std::vector>();
+	 * 	// output == {{1, 2, 3}, {4, 5, 6}}
+	 * @endcode
+	 */
+	template<typename TNumber, size_t DIGITS = 0>
+	requires std::is_arithmetic_v<TNumber>
+	auto parseChunk() {
+		return []<typename TChunk>(const TChunk& chunk) {
+			constexpr size_t CHUNK_SIZE = std::tuple_size_v<std::remove_cvref_t<TChunk>>;
+			std::array<TNumber, CHUNK_SIZE> result;
+			for(size_t i = 0; i < CHUNK_SIZE; ++i) {
+				if constexpr(DIGITS == 0) {
+					result[i] = parse<TNumber>()(chunk[i]);
+				} else {
+					result[i] = parseFixedWidth<TNumber, DIGITS>()(chunk[i]);
+				}
+			}
+			return result;
+		};
+	}
+
 }
@@ -0,0 +1,176 @@
+#pragma once
+
+#include <cstdlib>
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <utility>
+
+#include "Common.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// RESUMABLE CONSUMER
+	// ################################################################################################
+
+	/**
+	 * @brief Consumer of an iterator pipeline, that can be run in steps of a limited amount of items or time, and
+	 * is resumed where it stopped on the next step.
+	 * @details The consumer owns the iterator pipeline, as well as the consumer's state (e.g. the working value of
+	 * a fold, or the container collected into). This allows to interleave long-running pipelines with other work
+	 * (e.g. on an event loop), without stalling it. Created using CXXIter::IterApi::resumableForEach(),
+	 * CXXIter::IterApi::resumableFold() or CXXIter::IterApi::resumableCollect(). Multiple consumers can be run
+	 * fairly using CXXIter::RoundRobinScheduler.
+	 * @tparam TChainInput Type of the consumed iterator pipeline.
+	 * @tparam TState Type of the consumer's state, that is returned by result().
+	 * @tparam TConsumeFn Function called with the consumer's state and each element of the pipeline.
+	 */
+	template<typename TChainInput, typename TState, typename TConsumeFn>
+	class ResumableConsumer {
+		using Item = typename trait::Iterator<TChainInput>::Item;
+
+		TChainInput input;
+		TState state;
+		TConsumeFn consumeFn;
+		bool finished = false;
+
+	public:
+		ResumableConsumer(TChainInput&& input, TState&& state, TConsumeFn consumeFn)
+			: input(std::move(input)), state(std::move(state)), consumeFn(consumeFn) {}
+
+		/**
+		 * @brief Consume (at most) the next @p n elements of the iterator pipeline.
+		 * @details The end of the pipeline is only noticed when trying to pull another element. A step that consumed
+		 * exactly the last elements thus returns @c false, and the next step returns @c true without consuming anything.
+		 * @param n Maximum amount of elements to consume in this step.
+		 * @return @c true if the pipeline is exhausted (now or before), @c false if it is not yet known to be exhausted.
+		 */
+		bool step(size_t n) {
+			if(finished) [[unlikely]] { return true; }
+			for(size_t i = 0; i < n; ++i) {
+				auto item = trait::Iterator<TChainInput>::next(input);
+				if(!item.has_value()) [[unlikely]] {
+					finished = true;
+					return true;
+				}
+				consumeFn(state, std::forward<Item>(item.value()));
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Consume elements of the iterator pipeline, until it is exhausted or the given time @p budget is used up.
+		 * @details The clock is only checked every @p checkInterval elements, to keep its overhead low. At least
+		 * @p checkInterval elements are thus consumed per step (if available), even when the budget is zero.
+		 * @param budget Time after which to stop consuming elements.
+		 * @param checkInterval Amount of elements to consume between checks of the clock.
+		 * @return @c true if the pipeline is exhausted (now or before), @c false if it is not yet known to be exhausted
+		 * (see step()).
+		 */
+		template<typename TRep, typename TPeriod>
+		bool stepFor(std::chrono::duration<TRep, TPeriod> budget, size_t checkInterval = 64) {
+			const auto deadline = std::chrono::steady_clock::now() + budget;
+			while(!step(checkInterval)) {
+				if(std::chrono::steady_clock::now() >= deadline) { return false; }
+			}
+			return true;
+		}
+
+		/**
+		 * @brief Whether the iterator pipeline was completely consumed, and its end was noticed by a step.
+		 */
+		bool done() const { return finished; }
+
+		/**
+		 * @brief Get the state of this consumer (e.g. the working value of a fold, or the collected container).
+		 * @details This is only the final result once done() returns @c true.
+		 */
+		TState& result() { return state; }
+		/** @copydoc result() */
+		const TState& result() const { return state; }
+	};
+
+	// ################################################################################################
+	// ROUND ROBIN SCHEDULER
+	// ################################################################################################
+
+	/**
+	 * @brief Scheduler that runs multiple CXXIter::ResumableConsumer instances (or anything else with a
+	 * <code>bool step(size_t n)</code> method) fairly, by consuming a fixed amount of elements from each of them in turn.
+	 * @details The scheduler only references the consumers, so they have to outlive it (or at least until they are
+	 * done). Finished consumers are removed from the scheduler.
+	 *
+	 * Usage Example:
+	 * @code
+	 * 	auto small = CXXIter::range(0, 10).resumableFold(0, [](int& acc, int item) { acc += item; });
+	 * 	auto large = CXXIter::range(0, 1000000).resumableFold(0, [](int& acc, int item) { acc ^= item; });
+	 * 	CXXIter::RoundRobinScheduler scheduler(128);
+	 * 	scheduler.add(small);
+	 * 	scheduler.add(large);
+	 * 	while(scheduler.runFor(std::chrono::milliseconds(1))) {
+	 * 		// handle other events in between
+	 * 	}
+	 * 	// small.result() == 55
+	 * @endcode
+	 */
+	class RoundRobinScheduler {
+		std::deque<std::function<bool(size_t)>> consumers;
+		size_t itemsPerTurn;
+
+	public:
+		/**
+		 * @brief Create a new scheduler, that consumes @p itemsPerTurn elements from a consumer in each turn.
+		 */
+		explicit RoundRobinScheduler(size_t itemsPerTurn = 256) : itemsPerTurn(itemsPerTurn) {}
+
+		/**
+		 * @brief Add the given @p consumer to the end of the round.
+		 */
+		template<typename TConsumer>
+		requires requires(TConsumer& consumer, size_t n) { { consumer.step(n) } -> std::convertible_to<bool>; }
+		void add(TConsumer& consumer) {
+			consumers.emplace_back([&consumer](size_t n) { return consumer.step(n); });
+		}
+
+		/**
+		 * @brief Amount of consumers that are not yet done.
+		 */
+		size_t pending() const { return consumers.size(); }
+
+		/**
+		 * @brief Give the next consumer in the round one turn.
+		 * @return @c true if there are consumers left, that are not yet done.
+		 */
+		bool runTurn() {
+			if(consumers.empty()) { return false; }
+			std::function<bool(size_t)> consumer = std::move(consumers.front());
+			consumers.pop_front();
+			if(!consumer(itemsPerTurn)) {
+				consumers.push_back(std::move(consumer));
+			}
+			return !consumers.empty();
+		}
+
+		/**
+		 * @brief Give the consumers turns in round-robin order, until all are done or the given time @p budget is used up.
+		 * @return @c true if there are consumers left, that are not yet done.
+		 */
+		template<typename TRep, typename TPeriod>
+		bool runFor(std::chrono::duration<TRep, TPeriod> budget) {
+			const auto deadline = std::chrono::steady_clock::now() + budget;
+			while(runTurn()) {
+				if(std::chrono::steady_clock::now() >= deadline) { return true; }
+			}
+			return false;
+		}
+
+		/**
+		 * @brief Give the consumers turns in round-robin order, until all are done.
+		 */
+		void run() {
+			while(runTurn()) {}
+		}
+	};
+
+}
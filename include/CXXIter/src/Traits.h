@@ -1,5 +1,10 @@
 #pragma once
 
+#include <span>
+#include <memory>
+#include <iterator>
+#include <type_traits>
+
 #include "IterValue.h"
 #include "SizeHint.h"
 
@@ -89,6 +94,29 @@ namespace CXXIter::trait {
 		static constexpr inline ItemPtr currentPtr(typename trait::Iterator<T>::Self& self) = delete;
 	};
 
+	/**
+	 * @brief Trait, that iterators implement whose elements are stored in multiple contiguous blocks of memory,
+	 * such as a chain of multiple @c std::vector, or a flatMap() over vectors.
+	 * @details This allows consumers to process the elements one segment at a time, using tight loops over raw
+	 * pointers (which the compiler can vectorize), instead of pulling the elements one by one through the pipeline.
+	 */
+	template<typename T>
+	struct SegmentedIterator {
+		/**
+		 * @brief Type of a segment of this iterator's elements.
+		 * @details This keeps the const specifier.
+		 */
+		using Segment = std::span<std::remove_reference_t<typename Iterator<T>::Item>>;
+		/**
+		 * @brief Take the next segment of contiguously stored elements from this iterator.
+		 * @details All elements within the returned segment are consumed from the iterator. The segment stays
+		 * valid until the next element or segment is requested from the iterator.
+		 * @param self Reference to the instance of the class for which trait::SegmentedIterator is being specialized.
+		 * @return The next non-empty segment of elements, or an empty segment at the end of the iterator.
+		 */
+		static constexpr inline Segment nextSegment(typename trait::Iterator<T>::Self& self) = delete;
+	};
+
 	/**
 	* @brief Trait that extends the Iterator trait with double-ended functionality.
 	* @details Implementing this trait extends the iterator with the functionality to pull elements from the back.
@@ -259,6 +287,42 @@ namespace CXXIter::trait {
 			return skipN;
 		}
 
+	/**
+	 * @name Segmented iterator functionality (optional)
+	 */
+	//@{
+		/**
+		 * @brief Get the amount of remaining elements that are stored contiguously in memory, starting at the
+		 * next element of the iteration with the given @p iter state.
+		 * @note Implementing this is optional, since not all containers can support this.
+		 * @details This is used for @c CXXIter::SrcMov and @c CXXIter::SrcRef. The default implementation supports all
+		 * containers with contiguous iterators (e.g. @c std::vector), for which this is the whole remaining range.
+		 * Containers that are only stored in blocks (e.g. @c std::deque) are not supported, since their block layout
+		 * is implementation-defined.
+		 * @param container Container on which the current iteration is running.
+		 * @param iter The current iteration's state structure.
+		 * @return The amount of remaining elements stored contiguously, or @c 0 if there are no elements remaining.
+		 */
+		static constexpr inline size_t segmentSize([[maybe_unused]] const TContainer& container, const IteratorState& iter)
+		requires std::contiguous_iterator<typename TContainer::iterator> && std::is_lvalue_reference_v<ItemRef> {
+			return static_cast<size_t>(std::distance(iter.left, iter.right));
+		}
+		/**
+		 * @brief Get the amount of remaining elements that are stored contiguously in memory, starting at the
+		 * next element of the iteration with the given @p iter state.
+		 * @note Implementing this is optional, since not all containers can support this.
+		 * @details This is used for @c CXXIter::SrcCRef
+		 * @param container Container on which the current iteration is running.
+		 * @param iter The current iteration's state structure.
+		 * @return The amount of remaining elements stored contiguously, or @c 0 if there are no elements remaining.
+		 */
+		static constexpr inline size_t segmentSize([[maybe_unused]] const TContainer& container, const ConstIteratorState& iter)
+		requires std::contiguous_iterator<typename TContainer::const_iterator> && std::is_lvalue_reference_v<ItemConstRef> {
+			return static_cast<size_t>(std::distance(iter.left, iter.right));
+		}
+	//@}
+
+
 	/**
 	 * @name Double-Ended iterator functionality (optional)
 	 */
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdlib>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// BUFFERED
+	// ################################################################################################
+	namespace op {
+		/**
+		 * @private
+		 * @brief State shared between a Buffered iterator and its worker thread.
+		 * @details The worker thread pulls the elements from the input and pushes them into a bounded
+		 * single-producer / single-consumer ring buffer, from which they are popped by the consumer.
+		 * @c head and @c tail are monotonically increasing element counters, which additionally carry the
+		 * stop-request (head) and end-of-input (tail) flags in their highest bit. Both sides block using
+		 * @c std::atomic::wait() when the ring is full / empty. Input elements passed by reference are copied into
+		 * the ring by the worker, because the referenced elements may be invalidated once the input advances.
+		 */
+		template<typename TChainInput>
+		struct BufferedState {
+			using InputItem = typename TChainInput::Item;
+			using ItemOwned = std::remove_cvref_t<InputItem>;
+			static constexpr size_t FLAG_BIT = size_t(1) << (sizeof(size_t) * 8 - 1);
+			static constexpr size_t CACHE_LINE_SIZE = 64;
+
+			TChainInput input;
+			std::vector<IterValue<ItemOwned>> slots;
+			const size_t capacity;
+			std::exception_ptr exceptionPtr;
+			std::thread worker;
+
+			/** Amount of elements popped by the consumer. FLAG_BIT is set when the worker should stop. */
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> head = 0;
+			/** Amount of elements pushed by the worker. FLAG_BIT is set when the input is exhausted. */
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> tail = 0;
+
+			BufferedState(TChainInput&& input, size_t capacity)
+				: input(std::move(input)), slots(std::bit_ceil(std::max<size_t>(capacity, 1))), capacity(std::max<size_t>(capacity, 1)) {}
+			~BufferedState() {
+				head.fetch_or(FLAG_BIT, std::memory_order_release);
+				head.notify_one();
+				if(worker.joinable()) { worker.join(); }
+			}
+
+			void produce() {
+				const size_t mask = slots.size() - 1;
+				size_t pushed = 0;
+				try {
+					while(true) {
+						IterValue<InputItem> item = trait::Iterator<TChainInput>::next(input);
+						if(!item.has_value()) { break; }
+						while(true) {
+							const size_t popped = head.load(std::memory_order_acquire);
+							if(popped & FLAG_BIT) { return; }
+							if(pushed - popped < capacity) { break; }
+							head.wait(popped, std::memory_order_acquire);
+						}
+						slots[pushed & mask] = ItemOwned(std::forward<InputItem>(item.value()));
+						tail.store(++pushed, std::memory_order_release);
+						tail.notify_one();
+					}
+				} catch(...) {
+					exceptionPtr = std::current_exception();
+				}
+				tail.store(pushed | FLAG_BIT, std::memory_order_release);
+				tail.notify_one();
+			}
+
+			IterValue<ItemOwned> pop() {
+				if(!worker.joinable()) [[unlikely]] {
+					worker = std::thread([this]() { produce(); });
+				}
+				const size_t popped = head.load(std::memory_order_relaxed);
+				while(true) {
+					const size_t pushed = tail.load(std::memory_order_acquire);
+					if((pushed & ~FLAG_BIT) != popped) [[likely]] { break; }
+					if(pushed & FLAG_BIT) {
+						if(exceptionPtr) { std::rethrow_exception(std::exchange(exceptionPtr, {})); }
+						return {};
+					}
+					tail.wait(pushed, std::memory_order_acquire);
+				}
+				IterValue<ItemOwned> item = std::move(slots[popped & (slots.size() - 1)]);
+				head.store(popped + 1, std::memory_order_release);
+				head.notify_one();
+				return item;
+			}
+		};
+
+		/** @private */
+		template<typename TChainInput>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] Buffered : public IterApi<Buffered<TChainInput>> {
+			friend struct trait::Iterator<Buffered<TChainInput>>;
+			friend struct trait::ExactSizeIterator<Buffered<TChainInput>>;
+		private:
+			std::unique_ptr<BufferedState<TChainInput>> state;
+			SizeHint remainingHint;
+		public:
+			Buffered(TChainInput&& input, size_t capacity) : remainingHint(input.sizeHint()) {
+				state = std::make_unique<BufferedState<TChainInput>>(std::move(input), capacity);
+			}
+		};
+	}
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TChainInput>
+	struct trait::Iterator<op::Buffered<TChainInput>> {
+		// CXXIter Interface
+		using Self = op::Buffered<TChainInput>;
+		using Item = std::remove_cvref_t<typename TChainInput::Item>;
+
+		static inline IterValue<Item> next(Self& self) {
+			IterValue<Item> item = self.state->pop();
+			if(item.has_value()) [[likely]] { self.remainingHint.subtract(1); }
+			return item;
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) { return self.remainingHint; }
+		static constexpr inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+	/** @private */
+	template<CXXIterExactSizeIterator TChainInput>
+	struct trait::ExactSizeIterator<op::Buffered<TChainInput>> {
+		static constexpr inline size_t size(const op::Buffered<TChainInput>& self) { return self.remainingHint.lowerBound; }
+	};
+
+}
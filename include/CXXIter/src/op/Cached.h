@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cstdlib>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// CACHED
+	// ################################################################################################
+	namespace op {
+		/**
+		 * @private
+		 * @brief Recording of the elements produced by the input of a Cached handle, shared by the handle and
+		 * all of its iterators.
+		 */
+		template<typename TChainInput>
+		struct CachedState {
+			using InputItem = typename TChainInput::Item;
+			using ItemOwned = std::remove_cvref_t<InputItem>;
+
+			TChainInput input;
+			const SizeHint initialSizeHint;
+			std::vector<ItemOwned> items;
+			bool complete = false;
+
+			CachedState(TChainInput&& input) : input(std::move(input)), initialSizeHint(this->input.sizeHint()) {
+				items.reserve(initialSizeHint.expectedResultSize());
+			}
+
+			/** Make sure the element with index @p idx is recorded (if the input has that many elements). */
+			bool ensureRecorded(size_t idx) {
+				while(idx >= items.size()) {
+					if(complete) { return false; }
+					auto item = trait::Iterator<TChainInput>::next(input);
+					if(!item.has_value()) [[unlikely]] {
+						complete = true;
+						items.shrink_to_fit();
+						return false;
+					}
+					items.emplace_back(std::forward<InputItem>(item.value()));
+				}
+				return true;
+			}
+		};
+
+		/** @private */
+		template<typename TChainInput>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] CachedReplay : public IterApi<CachedReplay<TChainInput>> {
+			friend struct trait::Iterator<CachedReplay<TChainInput>>;
+			friend struct trait::DoubleEndedIterator<CachedReplay<TChainInput>>;
+			friend struct trait::ExactSizeIterator<CachedReplay<TChainInput>>;
+			friend struct trait::ContiguousMemoryIterator<CachedReplay<TChainInput>>;
+			friend struct trait::SegmentedIterator<CachedReplay<TChainInput>>;
+		private:
+			std::shared_ptr<const CachedState<TChainInput>> state;
+			size_t front = 0;
+			size_t back;
+		public:
+			CachedReplay(std::shared_ptr<const CachedState<TChainInput>> state) : state(std::move(state)), back(this->state->items.size()) {}
+		};
+
+		/** @private */
+		template<typename TChainInput>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] CachedIter : public IterApi<CachedIter<TChainInput>> {
+			friend struct trait::Iterator<CachedIter<TChainInput>>;
+			friend struct trait::ExactSizeIterator<CachedIter<TChainInput>>;
+		private:
+			std::shared_ptr<CachedState<TChainInput>> state;
+			size_t pos = 0;
+		public:
+			CachedIter(std::shared_ptr<CachedState<TChainInput>> state) : state(std::move(state)) {}
+		};
+
+		/**
+		 * @brief Handle to the recording of a pipeline, constructed by CXXIter::IterApi::cached().
+		 * @details The handle itself is no iterator. Instead, iter() and replay() hand out iterators over the
+		 * recording. Copies of the handle share the same recording.
+		 */
+		template<typename TChainInput>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] Cached {
+		private:
+			std::shared_ptr<CachedState<TChainInput>> state;
+		public:
+			Cached(TChainInput&& input) : state(std::make_shared<CachedState<TChainInput>>(std::move(input))) {}
+
+			/**
+			 * @brief Construct an iterator over all elements of the cached pipeline, that lazily runs the pipeline
+			 * while recording its elements.
+			 * @details Elements that were already recorded (e.g. by a previous iterator) are taken from the recording,
+			 * the pipeline is only run further once the iterator passes the end of the recording. A consumer that stops
+			 * early thus only computes the consumed prefix.
+			 * @return Iterator yielding copies of the elements of the cached pipeline, starting at its first element.
+			 */
+			CachedIter<TChainInput> iter() { return CachedIter<TChainInput>(state); }
+
+			/**
+			 * @brief Construct an iterator over all elements of the cached pipeline, from its recording.
+			 * @details Elements that were not yet produced by the cached pipeline are computed and recorded first.
+			 * Afterwards, the recording is never modified again - and the replay iterators pass references to the
+			 * recorded elements, that stay valid as long as this handle or any of its iterators exist.
+			 * @return Exact-size, double-ended iterator over the contiguously stored recording, passing
+			 * const references to the elements.
+			 */
+			CachedReplay<TChainInput> replay() {
+				state->ensureRecorded(std::numeric_limits<size_t>::max());
+				return CachedReplay<TChainInput>(state);
+			}
+
+			/**
+			 * @brief Whether the cached pipeline was completely traversed and recorded.
+			 */
+			bool isComplete() const { return state->complete; }
+
+			/**
+			 * @brief Amount of elements that are recorded so far.
+			 */
+			size_t recordedCnt() const { return state->items.size(); }
+		};
+	}
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TChainInput>
+	struct trait::Iterator<op::CachedIter<TChainInput>> {
+		// CXXIter Interface
+		using Self = op::CachedIter<TChainInput>;
+		using Item = std::remove_cvref_t<typename TChainInput::Item>;
+
+		static inline IterValue<Item> next(Self& self) {
+			if(!self.state->ensureRecorded(self.pos)) [[unlikely]] { return {}; }
+			return Item(self.state->items[self.pos++]);
+		}
+		static inline SizeHint sizeHint(const Self& self) {
+			if(self.state->complete) {
+				const size_t remaining = self.state->items.size() - self.pos;
+				return SizeHint(remaining, remaining);
+			}
+			SizeHint result = self.state->initialSizeHint;
+			result.subtract(self.pos);
+			return result;
+		}
+		static inline size_t advanceBy(Self& self, size_t n) {
+			if(n == 0) { return 0; }
+			const size_t skipped = (self.state->ensureRecorded(self.pos + n - 1)) ? n : (self.state->items.size() - self.pos);
+			self.pos += skipped;
+			return skipped;
+		}
+	};
+	/** @private */
+	template<CXXIterExactSizeIterator TChainInput>
+	struct trait::ExactSizeIterator<op::CachedIter<TChainInput>> {
+		static inline size_t size(const op::CachedIter<TChainInput>& self) {
+			return trait::Iterator<op::CachedIter<TChainInput>>::sizeHint(self).lowerBound;
+		}
+	};
+
+	/** @private */
+	template<typename TChainInput>
+	struct trait::Iterator<op::CachedReplay<TChainInput>> {
+		// CXXIter Interface
+		using Self = op::CachedReplay<TChainInput>;
+		using Item = const std::remove_cvref_t<typename TChainInput::Item>&;
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			if(self.front == self.back) [[unlikely]] { return {}; }
+			return self.state->items[self.front++];
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) { return SizeHint(self.back - self.front, self.back - self.front); }
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			const size_t skipped = std::min(n, self.back - self.front);
+			self.front += skipped;
+			return skipped;
+		}
+	};
+	/** @private */
+	template<typename TChainInput>
+	struct trait::DoubleEndedIterator<op::CachedReplay<TChainInput>> {
+		using Item = typename trait::Iterator<op::CachedReplay<TChainInput>>::Item;
+
+		// CXXIter Interface
+		static constexpr inline IterValue<Item> nextBack(op::CachedReplay<TChainInput>& self) {
+			if(self.front == self.back) [[unlikely]] { return {}; }
+			return self.state->items[--self.back];
+		}
+	};
+	/** @private */
+	template<typename TChainInput>
+	struct trait::ExactSizeIterator<op::CachedReplay<TChainInput>> {
+		static constexpr inline size_t size(const op::CachedReplay<TChainInput>& self) { return self.back - self.front; }
+	};
+	/** @private */
+	template<typename TChainInput>
+	struct trait::ContiguousMemoryIterator<op::CachedReplay<TChainInput>> {
+		using ItemPtr = const std::remove_cvref_t<typename TChainInput::Item>*;
+		static constexpr inline ItemPtr currentPtr(op::CachedReplay<TChainInput>& self) {
+			return self.state->items.data() + self.front;
+		}
+	};
+	/** @private */
+	template<typename TChainInput>
+	struct trait::SegmentedIterator<op::CachedReplay<TChainInput>> {
+		using Segment = std::span<const std::remove_cvref_t<typename TChainInput::Item>>;
+		static constexpr inline Segment nextSegment(op::CachedReplay<TChainInput>& self) {
+			Segment segment(self.state->items.data() + self.front, self.back - self.front);
+			self.front = self.back;
+			return segment;
+		}
+	};
+
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdlib>
+#include <optional>
+#include <algorithm>
+#include <vector>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// CACHED SORTER
+	// ################################################################################################
+	namespace op {
+		/** @private */
+		template<typename TChainInput, typename TSortValueExtractFn, SortOrder ORDER>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] CachedSorter : public IterApi<CachedSorter<TChainInput, TSortValueExtractFn, ORDER>> {
+			friend struct trait::Iterator<CachedSorter<TChainInput, TSortValueExtractFn, ORDER>>;
+			friend struct trait::DoubleEndedIterator<CachedSorter<TChainInput, TSortValueExtractFn, ORDER>>;
+			friend struct trait::ExactSizeIterator<CachedSorter<TChainInput, TSortValueExtractFn, ORDER>>;
+		private:
+			using OwnedInputItem = typename TChainInput::ItemOwned;
+			using SortValue = std::remove_cvref_t<std::invoke_result_t<TSortValueExtractFn, const OwnedInputItem&>>;
+
+			struct KeyedIndex {
+				SortValue sortValue;
+				size_t idx;
+			};
+
+			TChainInput input;
+			TSortValueExtractFn sortValueExtractFn;
+			std::optional<std::vector<OwnedInputItem>> sortCache;
+			size_t left = 0;
+			size_t right = 0;
+		public:
+			constexpr CachedSorter(TChainInput&& input, TSortValueExtractFn sortValueExtractFn)
+				: input(std::move(input)), sortValueExtractFn(sortValueExtractFn) {}
+		};
+	}
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TChainInput, typename TSortValueExtractFn, SortOrder ORDER>
+	struct trait::Iterator<op::CachedSorter<TChainInput, TSortValueExtractFn, ORDER>> {
+		using ChainInputIterator = trait::Iterator<TChainInput>;
+		using InputItem = typename TChainInput::Item;
+		using OwnedInputItem = typename TChainInput::ItemOwned;
+		// CXXIter Interface
+		using Self = op::CachedSorter<TChainInput, TSortValueExtractFn, ORDER>;
+		using Item = OwnedInputItem;
+
+		static constexpr inline void initSortCache(Self& self) {
+			using KeyedIndex = typename Self::KeyedIndex;
+
+			// drain input iterator, computing the sort value of each item exactly once
+			std::vector<OwnedInputItem> items;
+			std::vector<KeyedIndex> keys;
+			const size_t expectedSize = ChainInputIterator::sizeHint(self.input).lowerBound;
+			items.reserve(expectedSize);
+			keys.reserve(expectedSize);
+			while(true) {
+				auto item = ChainInputIterator::next(self.input);
+				if(!item.has_value()) [[unlikely]] { break; }
+				items.push_back(std::forward<InputItem>( item.value() ));
+				keys.push_back(KeyedIndex { self.sortValueExtractFn(items.back()), items.size() - 1 });
+			}
+
+			// sort the packed (sortValue, index) pairs. Ties are broken using the index, which makes this stable.
+			std::sort(keys.begin(), keys.end(), [](const KeyedIndex& a, const KeyedIndex& b) {
+				if constexpr(ORDER == SortOrder::ASCENDING) {
+					if(a.sortValue < b.sortValue) { return true; }
+					if(b.sortValue < a.sortValue) { return false; }
+				} else {
+					if(a.sortValue > b.sortValue) { return true; }
+					if(b.sortValue > a.sortValue) { return false; }
+				}
+				return (a.idx < b.idx);
+			});
+
+			// move the items into their sorted order
+			std::vector<OwnedInputItem> sortedItems;
+			sortedItems.reserve(items.size());
+			for(const KeyedIndex& key : keys) {
+				sortedItems.push_back(std::move(items[key.idx]));
+			}
+			self.left = 0;
+			self.right = sortedItems.size();
+			self.sortCache.emplace(std::move(sortedItems));
+		}
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			if(!self.sortCache.has_value()) [[unlikely]] { initSortCache(self); }
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return std::move((*self.sortCache)[self.left++]);
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) {
+			if(self.sortCache.has_value()) {
+				const size_t remaining = self.right - self.left;
+				return SizeHint(remaining, remaining);
+			}
+			return ChainInputIterator::sizeHint(self.input);
+		}
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			if(!self.sortCache.has_value()) [[unlikely]] { initSortCache(self); }
+			const size_t skipN = std::min(n, self.right - self.left);
+			self.left += skipN;
+			return skipN;
+		}
+	};
+	/** @private */
+	template<CXXIterDoubleEndedIterator TChainInput, typename TSortValueExtractFn, SortOrder ORDER>
+	struct trait::DoubleEndedIterator<op::CachedSorter<TChainInput, TSortValueExtractFn, ORDER>> {
+		using OwnedInputItem = typename TChainInput::ItemOwned;
+		// CXXIter Interface
+		using Self = op::CachedSorter<TChainInput, TSortValueExtractFn, ORDER>;
+		using Item = OwnedInputItem;
+
+		static constexpr inline IterValue<Item> nextBack(Self& self) {
+			if(!self.sortCache.has_value()) [[unlikely]] { trait::Iterator<Self>::initSortCache(self); }
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return std::move((*self.sortCache)[--self.right]);
+		}
+	};
+	/** @private */
+	template<CXXIterExactSizeIterator TChainInput, typename TSortValueExtractFn, SortOrder ORDER>
+	struct trait::ExactSizeIterator<op::CachedSorter<TChainInput, TSortValueExtractFn, ORDER>> {
+		static constexpr inline size_t size(const op::CachedSorter<TChainInput, TSortValueExtractFn, ORDER>& self) {
+			if(self.sortCache.has_value()) { return self.right - self.left; }
+			return trait::ExactSizeIterator<TChainInput>::size(self.input);
+		}
+	};
+
+}
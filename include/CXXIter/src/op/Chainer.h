@@ -17,6 +17,7 @@ namespace CXXIter {
 			friend struct trait::Iterator<Chainer<TChainInput1, TChainInput2>>;
 			friend struct trait::DoubleEndedIterator<Chainer<TChainInput1, TChainInput2>>;
 			friend struct trait::ExactSizeIterator<Chainer<TChainInput1, TChainInput2>>;
+			friend struct trait::SegmentedIterator<Chainer<TChainInput1, TChainInput2>>;
 		private:
 			TChainInput1 input1;
 			TChainInput2 input2;
@@ -104,4 +105,29 @@ namespace CXXIter {
 		}
 	};
 
+	/** @private */
+	template<CXXIterSegmentedIterator TChainInput1, CXXIterSegmentedIterator TChainInput2>
+	requires std::is_same_v<typename trait::SegmentedIterator<TChainInput1>::Segment, typename trait::SegmentedIterator<TChainInput2>::Segment>
+	struct trait::SegmentedIterator<op::Chainer<TChainInput1, TChainInput2>> {
+		using ChainInputIterator1 = trait::SegmentedIterator<TChainInput1>;
+		using ChainInputIterator2 = trait::SegmentedIterator<TChainInput2>;
+		// CXXIter Interface
+		using Self = op::Chainer<TChainInput1, TChainInput2>;
+		using Segment = typename ChainInputIterator1::Segment;
+
+		static constexpr inline Segment nextSegment(Self& self) {
+			if(!self.input1Ended) {
+				Segment segment = ChainInputIterator1::nextSegment(self.input1);
+				if(!segment.empty()) [[likely]] { return segment; }
+				self.input1Ended = true;
+			}
+			if(!self.input2Ended) {
+				Segment segment = ChainInputIterator2::nextSegment(self.input2);
+				if(!segment.empty()) [[likely]] { return segment; }
+				self.input2Ended = true;
+			}
+			return {};
+		}
+	};
+
 }
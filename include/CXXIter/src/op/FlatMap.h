@@ -18,6 +18,7 @@ namespace CXXIter {
 		requires (!std::is_reference_v<TItemContainer>)
 		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] FlatMap : public IterApi<FlatMap<TChainInput, TFlatMapFn, TItemContainer>> {
 			friend struct trait::Iterator<FlatMap<TChainInput, TFlatMapFn, TItemContainer>>;
+			friend struct trait::SegmentedIterator<FlatMap<TChainInput, TFlatMapFn, TItemContainer>>;
 		private:
 			TChainInput input;
 			std::optional<SrcMov<TItemContainer>> current;
@@ -60,4 +61,33 @@ namespace CXXIter {
 		static constexpr inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
 	};
 
+	/** @private */
+	template<typename TChainInput, typename TFlatMapFn, typename TItemContainer>
+	requires CXXIterSegmentedIterator<SrcMov<TItemContainer>>
+	struct trait::SegmentedIterator<op::FlatMap<TChainInput, TFlatMapFn, TItemContainer>> {
+		using NestedChainIterator = trait::SegmentedIterator<SrcMov<TItemContainer>>;
+		using ChainInputIterator = trait::Iterator<TChainInput>;
+		using InputItem = typename ChainInputIterator::Item;
+		// CXXIter Interface
+		using Self = op::FlatMap<TChainInput, TFlatMapFn, TItemContainer>;
+		using Segment = typename NestedChainIterator::Segment;
+
+		static constexpr inline Segment nextSegment(Self& self) {
+			while(true) {
+				if(!self.current) { // pull new container from the outer iterator
+					auto item = ChainInputIterator::next(self.input);
+					if(!item.has_value()) [[unlikely]] { return {}; } // end of iteration
+					self.current = SrcMov(std::move(
+						self.mapFn(std::forward<InputItem>( item.value() ))
+					));
+				}
+
+				// take the segments of the current container, until we reach its end
+				Segment segment = NestedChainIterator::nextSegment(*self.current);
+				if(!segment.empty()) [[likely]] { return segment; }
+				self.current.reset();
+			}
+		}
+	};
+
 }
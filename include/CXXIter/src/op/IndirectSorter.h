@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdlib>
+#include <optional>
+#include <algorithm>
+#include <vector>
+
+#include "../Common.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// INDIRECT SORTER
+	// ################################################################################################
+	namespace op {
+		/** @private */
+		template<typename TChainInput, typename TCompareFn, bool STABLE>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] IndirectSorter : public IterApi<IndirectSorter<TChainInput, TCompareFn, STABLE>> {
+			friend struct trait::Iterator<IndirectSorter<TChainInput, TCompareFn, STABLE>>;
+			friend struct trait::DoubleEndedIterator<IndirectSorter<TChainInput, TCompareFn, STABLE>>;
+			friend struct trait::ExactSizeIterator<IndirectSorter<TChainInput, TCompareFn, STABLE>>;
+		private:
+			using ItemPtr = std::add_pointer_t<std::remove_reference_t<typename TChainInput::Item>>;
+
+			TChainInput input;
+			TCompareFn compareFn;
+			std::optional<std::vector<ItemPtr>> sortCache;
+			size_t left = 0;
+			size_t right = 0;
+		public:
+			constexpr IndirectSorter(TChainInput&& input, TCompareFn compareFn) : input(std::move(input)), compareFn(compareFn) {}
+		};
+	}
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TChainInput, typename TCompareFn, bool STABLE>
+	struct trait::Iterator<op::IndirectSorter<TChainInput, TCompareFn, STABLE>> {
+		using ChainInputIterator = trait::Iterator<TChainInput>;
+		using InputItem = typename TChainInput::Item;
+		// CXXIter Interface
+		using Self = op::IndirectSorter<TChainInput, TCompareFn, STABLE>;
+		using Item = InputItem;
+
+		static constexpr inline void initSortCache(Self& self) {
+			using ItemPtr = typename Self::ItemPtr;
+
+			// drain input iterator, only remembering the address of each item
+			std::vector<ItemPtr> sortCache;
+			sortCache.reserve(ChainInputIterator::sizeHint(self.input).lowerBound);
+			while(true) {
+				auto item = ChainInputIterator::next(self.input);
+				if(!item.has_value()) [[unlikely]] { break; }
+				sortCache.push_back(&item.value());
+			}
+			// sort the pointers by the items they point to
+			auto compareFn = [&self](ItemPtr a, ItemPtr b) { return self.compareFn(*a, *b); };
+			if constexpr(STABLE) {
+				std::stable_sort(sortCache.begin(), sortCache.end(), compareFn);
+			} else {
+				std::sort(sortCache.begin(), sortCache.end(), compareFn);
+			}
+			self.left = 0;
+			self.right = sortCache.size();
+			self.sortCache.emplace(std::move(sortCache));
+		}
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			if(!self.sortCache.has_value()) [[unlikely]] { initSortCache(self); }
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return *(*self.sortCache)[self.left++];
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) {
+			if(self.sortCache.has_value()) {
+				const size_t remaining = self.right - self.left;
+				return SizeHint(remaining, remaining);
+			}
+			return ChainInputIterator::sizeHint(self.input);
+		}
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			if(!self.sortCache.has_value()) [[unlikely]] { initSortCache(self); }
+			const size_t skipN = std::min(n, self.right - self.left);
+			self.left += skipN;
+			return skipN;
+		}
+	};
+	/** @private */
+	template<CXXIterDoubleEndedIterator TChainInput, typename TCompareFn, bool STABLE>
+	struct trait::DoubleEndedIterator<op::IndirectSorter<TChainInput, TCompareFn, STABLE>> {
+		// CXXIter Interface
+		using Self = op::IndirectSorter<TChainInput, TCompareFn, STABLE>;
+		using Item = typename TChainInput::Item;
+
+		static constexpr inline IterValue<Item> nextBack(Self& self) {
+			if(!self.sortCache.has_value()) [[unlikely]] { trait::Iterator<Self>::initSortCache(self); }
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return *(*self.sortCache)[--self.right];
+		}
+	};
+	/** @private */
+	template<CXXIterExactSizeIterator TChainInput, typename TCompareFn, bool STABLE>
+	struct trait::ExactSizeIterator<op::IndirectSorter<TChainInput, TCompareFn, STABLE>> {
+		static constexpr inline size_t size(const op::IndirectSorter<TChainInput, TCompareFn, STABLE>& self) {
+			if(self.sortCache.has_value()) { return self.right - self.left; }
+			return trait::ExactSizeIterator<TChainInput>::size(self.input);
+		}
+	};
+
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <cstdlib>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// PARALLEL MAP
+	// ################################################################################################
+	namespace op {
+		/**
+		 * @private
+		 * @brief Batch of input elements, that is mapped by one of ParMap's worker threads.
+		 * @details Input elements that are passed by reference are copied into the batch by the consumer thread,
+		 * because the referenced elements may be invalidated once the input advances (e.g. CSV records).
+		 */
+		template<typename TInputItem, typename TResult>
+		struct ParMapBatch {
+			using Input = std::remove_cvref_t<TInputItem>;
+			std::vector<Input> inputs;
+			std::vector<TResult> results;
+			std::exception_ptr exceptionPtr;
+			bool started = false;
+			bool done = false;
+		};
+
+		/**
+		 * @private
+		 * @brief Worker threads of a ParMap iterator, and the batches that are currently in flight.
+		 * @details The consumer thread pulls the input elements, groups them into batches and submits them to the
+		 * workers. At most @c maxInFlight batches are in flight at the same time. When @c ORDERED, the batches are
+		 * taken back in submission order (bounded reorder buffer), otherwise in order of completion.
+		 */
+		template<typename TInputItem, typename TMapFn, typename TResult, bool ORDERED>
+		class ParMapPool {
+			using Batch = ParMapBatch<TInputItem, TResult>;
+
+			const TMapFn mapFn;
+			const size_t threadCnt;
+			const size_t maxInFlight;
+
+			std::mutex mutex;
+			std::condition_variable workAvailable;
+			std::condition_variable batchDone;
+			std::deque<Batch*> queue;
+			bool stopRequested = false;
+			std::vector<std::thread> workers;
+			/** Submitted batches, in submission order. Only accessed by the consumer thread. */
+			std::deque<std::unique_ptr<Batch>> inFlight;
+
+			void work() {
+				while(true) {
+					Batch* batch;
+					{
+						std::unique_lock lock(mutex);
+						workAvailable.wait(lock, [this]() { return stopRequested || !queue.empty(); });
+						if(stopRequested) { return; }
+						batch = queue.front();
+						queue.pop_front();
+						batch->started = true;
+					}
+					try {
+						batch->results.reserve(batch->inputs.size());
+						for(typename Batch::Input& item : batch->inputs) {
+							batch->results.push_back(std::invoke(mapFn, std::forward<TInputItem>(item)));
+						}
+					} catch(...) {
+						batch->exceptionPtr = std::current_exception();
+					}
+					{
+						std::lock_guard lock(mutex);
+						batch->done = true;
+					}
+					batchDone.notify_one();
+				}
+			}
+
+		public:
+			ParMapPool(TMapFn mapFn, size_t threadCnt)
+				: mapFn(mapFn), threadCnt(std::max<size_t>(threadCnt, 1)), maxInFlight(2 * this->threadCnt) {}
+			~ParMapPool() {
+				{
+					std::lock_guard lock(mutex);
+					stopRequested = true;
+				}
+				workAvailable.notify_all();
+				for(std::thread& worker : workers) { worker.join(); }
+			}
+
+			bool canSubmit() const { return inFlight.size() < maxInFlight; }
+			bool empty() const { return inFlight.empty(); }
+
+			void submit(std::unique_ptr<Batch> batch) {
+				if(workers.empty()) [[unlikely]] {
+					workers.reserve(threadCnt);
+					for(size_t i = 0; i < threadCnt; ++i) {
+						workers.emplace_back([this]() { work(); });
+					}
+				}
+				{
+					std::lock_guard lock(mutex);
+					queue.push_back(batch.get());
+				}
+				inFlight.push_back(std::move(batch));
+				workAvailable.notify_one();
+			}
+
+			/** Discard all batches in flight, waiting for the ones that are currently being mapped by a worker. */
+			void discardAll() {
+				std::unique_lock lock(mutex);
+				queue.clear();
+				batchDone.wait(lock, [this]() {
+					return std::all_of(inFlight.begin(), inFlight.end(), [](const auto& batch) { return !batch->started || batch->done; });
+				});
+				inFlight.clear();
+			}
+
+			/** Wait for the next completed batch (the oldest one if ORDERED), and take it out of the pool. */
+			std::unique_ptr<Batch> takeCompleted() {
+				std::unique_lock lock(mutex);
+				if constexpr(ORDERED) {
+					batchDone.wait(lock, [this]() { return inFlight.front()->done; });
+					std::unique_ptr<Batch> batch = std::move(inFlight.front());
+					inFlight.pop_front();
+					return batch;
+				} else {
+					auto completedIter = inFlight.end();
+					batchDone.wait(lock, [this, &completedIter]() {
+						completedIter = std::find_if(inFlight.begin(), inFlight.end(), [](const auto& batch) { return batch->done; });
+						return completedIter != inFlight.end();
+					});
+					std::unique_ptr<Batch> batch = std::move(*completedIter);
+					inFlight.erase(completedIter);
+					return batch;
+				}
+			}
+		};
+
+		/** @private */
+		template<typename TChainInput, typename TMapFn, typename TItem, bool ORDERED>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] ParMap : public IterApi<ParMap<TChainInput, TMapFn, TItem, ORDERED>> {
+			friend struct trait::Iterator<ParMap<TChainInput, TMapFn, TItem, ORDERED>>;
+			friend struct trait::ExactSizeIterator<ParMap<TChainInput, TMapFn, TItem, ORDERED>>;
+
+			using InputItem = typename TChainInput::Item;
+			using Pool = ParMapPool<InputItem, TMapFn, TItem, ORDERED>;
+			using Batch = ParMapBatch<InputItem, TItem>;
+		private:
+			TChainInput input;
+			size_t batchSize;
+			bool inputExhausted = false;
+			/** Size hint of the input at construction, reduced by the amount of elements returned since. */
+			SizeHint remainingHint;
+			std::unique_ptr<Pool> pool;
+			std::unique_ptr<Batch> current;
+			size_t currentIdx = 0;
+		public:
+			ParMap(TChainInput&& input, TMapFn mapFn, size_t threadCnt, size_t batchSize)
+				: input(std::move(input)), batchSize(std::max<size_t>(batchSize, 1)), remainingHint(this->input.sizeHint()),
+				  pool(std::make_unique<Pool>(mapFn, threadCnt)) {}
+		};
+	}
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TChainInput, typename TMapFn, typename TItem, bool ORDERED>
+	struct trait::Iterator<op::ParMap<TChainInput, TMapFn, TItem, ORDERED>> {
+		using ChainInputIterator = trait::Iterator<TChainInput>;
+		// CXXIter Interface
+		using Self = op::ParMap<TChainInput, TMapFn, TItem, ORDERED>;
+		using Item = TItem;
+
+		static inline IterValue<Item> next(Self& self) {
+			while(true) {
+				if(self.current) {
+					if(self.currentIdx < self.current->results.size()) [[likely]] {
+						self.remainingHint.subtract(1);
+						return std::move(self.current->results[self.currentIdx++]);
+					}
+					std::exception_ptr exceptionPtr = std::exchange(self.current->exceptionPtr, {});
+					self.remainingHint.subtract(self.current->inputs.size() - self.current->results.size());
+					self.current.reset();
+					if(exceptionPtr) [[unlikely]] {
+						// errors are terminal: discard everything after the failed element
+						self.inputExhausted = true;
+						self.pool->discardAll();
+						self.remainingHint = SizeHint(0, 0);
+						std::rethrow_exception(exceptionPtr);
+					}
+				}
+				// keep the workers busy
+				while(!self.inputExhausted && self.pool->canSubmit()) {
+					auto batch = std::make_unique<typename Self::Batch>();
+					batch->inputs.reserve(self.batchSize);
+					while(batch->inputs.size() < self.batchSize) {
+						auto item = ChainInputIterator::next(self.input);
+						if(!item.has_value()) [[unlikely]] {
+							self.inputExhausted = true;
+							break;
+						}
+						batch->inputs.emplace_back(std::forward<typename Self::InputItem>(item.value()));
+					}
+					if(batch->inputs.empty()) { break; }
+					self.pool->submit(std::move(batch));
+				}
+				if(self.pool->empty()) { return {}; }
+				self.current = self.pool->takeCompleted();
+				self.currentIdx = 0;
+			}
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) { return self.remainingHint; }
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+	/** @private */
+	template<CXXIterExactSizeIterator TChainInput, typename TMapFn, typename TItem, bool ORDERED>
+	struct trait::ExactSizeIterator<op::ParMap<TChainInput, TMapFn, TItem, ORDERED>> {
+		static constexpr inline size_t size(const op::ParMap<TChainInput, TMapFn, TItem, ORDERED>& self) { return self.remainingHint.lowerBound; }
+	};
+
+}
@@ -25,7 +25,7 @@ namespace CXXIter {
 			struct NoReverseCache {};
 			using ReverseCacheContainer = std::conditional_t<
 					std::is_reference_v<InputItem>,
-					std::vector<std::reference_wrapper<InputItem>>,
+					std::vector<std::reference_wrapper<std::remove_reference_t<InputItem>>>,
 					std::vector<InputItem>>;
 			using ReverseCache = SrcMov<ReverseCacheContainer>;
 
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstdlib>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// TEE
+	// ################################################################################################
+	namespace op {
+		/**
+		 * @private
+		 * @brief Upstream iterator shared by all branches of a tee, and the window of its elements that was
+		 * pulled but not yet consumed by all branches.
+		 * @details Each buffered element counts the branches that still have to consume it. The last branch to
+		 * consume an element moves it out, instead of copying it, and it is released from the buffer as soon as
+		 * it is at the front. When the buffer is full, the branches that are ahead block until the slowest one
+		 * caught up. If the input throws, it is not advanced any further. Instead, the exception is stored and
+		 * rethrown to every branch that reaches the failed element.
+		 */
+		template<typename TChainInput>
+		class TeeState {
+			using InputItem = typename TChainInput::Item;
+			using ItemOwned = std::remove_cvref_t<InputItem>;
+
+			struct Entry {
+				ItemOwned item;
+				size_t remaining;
+			};
+
+			TChainInput input;
+			const size_t capacity;
+			std::mutex mutex;
+			std::condition_variable progress;
+			std::deque<Entry> buffer;
+			/** Index of the element at the front of the buffer. */
+			size_t bufferStart = 0;
+			size_t activeBranchCnt;
+			size_t waitingBranchCnt = 0;
+			bool inputExhausted = false;
+			/** Exception thrown by the input, at the element with index bufferStart + buffer.size(). */
+			std::exception_ptr exceptionPtr;
+
+			void releaseConsumed() {
+				bool released = false;
+				while(!buffer.empty() && buffer.front().remaining == 0) {
+					buffer.pop_front();
+					++bufferStart;
+					released = true;
+				}
+				if(released && waitingBranchCnt > 0) { progress.notify_all(); }
+			}
+
+		public:
+			const SizeHint initialSizeHint;
+
+			TeeState(TChainInput&& input, size_t branchCnt, size_t capacity)
+				: input(std::move(input)), capacity(std::max<size_t>(capacity, 1)), activeBranchCnt(branchCnt),
+				  initialSizeHint(this->input.sizeHint()) {}
+
+			/** Take the element with index @p pos for a branch, pulling it from the input if necessary. */
+			IterValue<ItemOwned> take(size_t pos) {
+				std::unique_lock lock(mutex);
+				while(pos >= bufferStart + buffer.size()) {
+					if(exceptionPtr && pos == bufferStart + buffer.size()) [[unlikely]] { std::rethrow_exception(exceptionPtr); }
+					if(inputExhausted) { return {}; }
+					if(buffer.size() < capacity) {
+						try {
+							auto item = trait::Iterator<TChainInput>::next(input);
+							if(!item.has_value()) [[unlikely]] {
+								inputExhausted = true;
+								if(waitingBranchCnt > 0) { progress.notify_all(); }
+								return {};
+							}
+							buffer.push_back(Entry { ItemOwned(std::forward<InputItem>(item.value())), activeBranchCnt });
+						} catch(...) {
+							exceptionPtr = std::current_exception();
+							inputExhausted = true;
+							if(waitingBranchCnt > 0) { progress.notify_all(); }
+							throw;
+						}
+						if(waitingBranchCnt > 0) { progress.notify_all(); }
+					} else {
+						++waitingBranchCnt;
+						progress.wait(lock);
+						--waitingBranchCnt;
+					}
+				}
+				Entry& entry = buffer[pos - bufferStart];
+				if(--entry.remaining > 0) { return ItemOwned(entry.item); }
+				IterValue<ItemOwned> result(std::move(entry.item));
+				releaseConsumed();
+				return result;
+			}
+
+			/** Detach a (destroyed) branch at position @p pos, such that it no longer holds back the buffer. */
+			void detach(size_t pos) {
+				std::lock_guard lock(mutex);
+				--activeBranchCnt;
+				for(size_t i = std::max(pos, bufferStart) - bufferStart; i < buffer.size(); ++i) {
+					--buffer[i].remaining;
+				}
+				releaseConsumed();
+			}
+		};
+
+		/** @private */
+		template<typename TChainInput>
+		class [[nodiscard(CXXITER_CHAINER_NODISCARD_WARNING)]] TeeBranch : public IterApi<TeeBranch<TChainInput>> {
+			friend struct trait::Iterator<TeeBranch<TChainInput>>;
+			friend struct trait::ExactSizeIterator<TeeBranch<TChainInput>>;
+		private:
+			std::shared_ptr<TeeState<TChainInput>> state;
+			size_t pos = 0;
+		public:
+			TeeBranch(std::shared_ptr<TeeState<TChainInput>> state) : state(std::move(state)) {}
+			TeeBranch(TeeBranch&& o) : state(std::move(o.state)), pos(o.pos) {}
+			TeeBranch& operator=(TeeBranch&& o) {
+				if(this != &o) {
+					if(state) { state->detach(pos); }
+					state = std::move(o.state);
+					pos = o.pos;
+				}
+				return *this;
+			}
+			~TeeBranch() {
+				if(state) { state->detach(pos); }
+			}
+		};
+	}
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TChainInput>
+	struct trait::Iterator<op::TeeBranch<TChainInput>> {
+		// CXXIter Interface
+		using Self = op::TeeBranch<TChainInput>;
+		using Item = std::remove_cvref_t<typename TChainInput::Item>;
+
+		static inline IterValue<Item> next(Self& self) {
+			try {
+				IterValue<Item> item = self.state->take(self.pos);
+				if(item.has_value()) [[likely]] { ++self.pos; }
+				return item;
+			} catch(...) {
+				// step over the failed element, such that each branch rethrows the exception only once
+				++self.pos;
+				throw;
+			}
+		}
+		static inline SizeHint sizeHint(const Self& self) {
+			SizeHint result = self.state->initialSizeHint;
+			result.subtract(self.pos);
+			return result;
+		}
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+	/** @private */
+	template<CXXIterExactSizeIterator TChainInput>
+	struct trait::ExactSizeIterator<op::TeeBranch<TChainInput>> {
+		static inline size_t size(const op::TeeBranch<TChainInput>& self) {
+			return trait::Iterator<op::TeeBranch<TChainInput>>::sizeHint(self).lowerBound;
+		}
+	};
+
+}
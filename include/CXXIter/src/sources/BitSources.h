@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <bitset>
+#include <optional>
+#include <span>
+
+#include "../Common.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// SOURCE (SET BITS)
+	// ################################################################################################
+	/**
+	 * @brief CXXIter iterator source that yields the indices of all set bits in a bitmap of 64bit words,
+	 * in ascending order.
+	 * @details Bit @c i of word @c w has the index <tt>w * 64 + i</tt>. The bitmap is scanned one word at a
+	 * time, locating the set bits using @c std::countr_zero, which makes this O(set bits) instead of O(bits).
+	 * @tparam TWords Storage of the words. Either a (borrowed) @c std::span, or an (owned) @c std::array.
+	 */
+	template<typename TWords>
+	class SrcBits : public IterApi<SrcBits<TWords>> {
+		friend struct trait::Iterator<SrcBits<TWords>>;
+		friend struct trait::ExactSizeIterator<SrcBits<TWords>>;
+	private:
+		TWords words;
+		size_t wordIdx = 0;
+		/** Bits of the current word that were not yet yielded */
+		uint64_t curWord = 0;
+		/** Amount of remaining set bits. Computed lazily, when first requested. */
+		mutable std::optional<size_t> remaining;
+
+		/** Move to the next non-empty word. Returns false if there is none. */
+		constexpr bool seekNonEmptyWord() {
+			while(curWord == 0) {
+				if(wordIdx + 1 >= words.size()) [[unlikely]] { return false; }
+				curWord = words[++wordIdx];
+			}
+			return true;
+		}
+		constexpr size_t remainingCnt() const {
+			if(!remaining.has_value()) {
+				size_t cnt = std::popcount(curWord);
+				for(size_t i = wordIdx + 1; i < words.size(); ++i) { cnt += std::popcount(words[i]); }
+				remaining = cnt;
+			}
+			return remaining.value();
+		}
+	public:
+		constexpr SrcBits(TWords words) : words(words) {
+			if(this->words.size() > 0) { curWord = this->words[0]; }
+		}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TWords>
+	struct trait::Iterator<SrcBits<TWords>> {
+		// CXXIter Interface
+		using Self = SrcBits<TWords>;
+		using Item = size_t;
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			if(!self.seekNonEmptyWord()) [[unlikely]] { return {}; }
+			const size_t bitIdx = std::countr_zero(self.curWord);
+			self.curWord &= (self.curWord - 1); // clear lowest set bit
+			if(self.remaining.has_value()) { self.remaining.value() -= 1; }
+			return self.wordIdx * 64 + bitIdx;
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) {
+			const size_t remaining = self.remainingCnt();
+			return SizeHint(remaining, remaining);
+		}
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			size_t skipped = 0;
+			while(skipped < n && self.seekNonEmptyWord()) {
+				const size_t wordBitCnt = std::popcount(self.curWord);
+				if(wordBitCnt <= n - skipped) {
+					// skip the whole word at once
+					skipped += wordBitCnt;
+					self.curWord = 0;
+				} else {
+					for(; skipped < n; ++skipped) { self.curWord &= (self.curWord - 1); }
+				}
+			}
+			if(self.remaining.has_value()) { self.remaining.value() -= skipped; }
+			return skipped;
+		}
+	};
+	/** @private */
+	template<typename TWords>
+	struct trait::ExactSizeIterator<SrcBits<TWords>> {
+		static constexpr inline size_t size(const SrcBits<TWords>& self) { return self.remainingCnt(); }
+	};
+
+	namespace util {
+		/**
+		 * @brief Convert the given @p bitset to an array of 64bit words, where bit @c i of the bitset is
+		 * bit <tt>i % 64</tt> of word <tt>i / 64</tt>.
+		 */
+		template<size_t N>
+		std::array<uint64_t, (N + 63) / 64> bitsetToWords(const std::bitset<N>& bitset) {
+			std::array<uint64_t, (N + 63) / 64> result = {};
+			if constexpr(N <= 64) {
+				if constexpr(N > 0) { result[0] = bitset.to_ullong(); }
+			} else {
+				// one linear pass over the bits - shifting the whole bitset per word would be quadratic
+				for(size_t i = 0; i < result.size(); ++i) {
+					const size_t wordEnd = std::min(N, (i + 1) * 64);
+					uint64_t word = 0;
+					for(size_t bit = i * 64; bit < wordEnd; ++bit) {
+						word |= static_cast<uint64_t>(bitset[bit]) << (bit % 64);
+					}
+					result[i] = word;
+				}
+			}
+			return result;
+		}
+	}
+
+}
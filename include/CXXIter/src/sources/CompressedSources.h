@@ -0,0 +1,360 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	namespace util {
+		/** @brief Amount of values per block in the bit-packed format. */
+		static constexpr size_t BITPACK_BLOCK_SIZE = 128;
+		/** @brief Maximum amount of bytes of the packed values in a block (at 32 bits per value). */
+		static constexpr size_t BITPACK_MAX_PACKED_SIZE = BITPACK_BLOCK_SIZE * 32 / 8;
+
+		/**
+		 * @brief Unpack one block of @c BITPACK_BLOCK_SIZE values with @p width bits each from @p src into @p dst.
+		 * @details The packed bytes are first copied into a padded buffer, such that every value can be extracted
+		 * with one unaligned 64bit load, shift and mask - without branches, so the loop can be auto-vectorized.
+		 */
+		inline void bitUnpackBlock(const uint8_t* src, uint8_t width, uint32_t* dst) {
+			if(width == 0) {
+				std::fill_n(dst, BITPACK_BLOCK_SIZE, 0);
+				return;
+			}
+			uint8_t padded[BITPACK_MAX_PACKED_SIZE + sizeof(uint64_t)] = {};
+			std::memcpy(padded, src, BITPACK_BLOCK_SIZE * width / 8);
+			const uint64_t mask = (uint64_t(1) << width) - 1;
+			for(size_t i = 0; i < BITPACK_BLOCK_SIZE; ++i) {
+				const size_t bitPos = i * width;
+				uint64_t word;
+				std::memcpy(&word, padded + bitPos / 8, sizeof(word));
+				dst[i] = static_cast<uint32_t>((word >> (bitPos % 8)) & mask);
+			}
+		}
+
+		/**
+		 * @brief Pack one block of @c BITPACK_BLOCK_SIZE values from @p src with @p width bits each, appending them to @p dst.
+		 */
+		inline void bitPackBlock(const uint32_t* src, uint8_t width, std::vector<uint8_t>& dst) {
+			uint8_t padded[BITPACK_MAX_PACKED_SIZE + sizeof(uint64_t)] = {};
+			for(size_t i = 0; i < BITPACK_BLOCK_SIZE; ++i) {
+				const size_t bitPos = i * width;
+				uint64_t word;
+				std::memcpy(&word, padded + bitPos / 8, sizeof(word));
+				word |= static_cast<uint64_t>(src[i]) << (bitPos % 8);
+				std::memcpy(padded + bitPos / 8, &word, sizeof(word));
+			}
+			dst.insert(dst.end(), padded, padded + BITPACK_BLOCK_SIZE * width / 8);
+		}
+
+		template<typename T>
+		void appendRaw(std::vector<uint8_t>& dst, T value) {
+			const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
+			dst.insert(dst.end(), bytes, bytes + sizeof(T));
+		}
+	}
+
+	// ################################################################################################
+	// ENCODERS
+	// ################################################################################################
+
+	/**
+	 * @brief Encode the given @p values as varints (LEB128: 7 bits per byte, least significant group first,
+	 * with the top bit set on all but the last byte of each value).
+	 * @details This is the format decoded by CXXIter::fromVarint().
+	 * @param values Values to encode.
+	 * @return The encoded bytes.
+	 */
+	template<std::unsigned_integral TValue>
+	std::vector<uint8_t> encodeVarint(std::span<const TValue> values) {
+		std::vector<uint8_t> result;
+		result.reserve(values.size());
+		for(TValue value : values) {
+			while(value >= 0x80) {
+				result.push_back(static_cast<uint8_t>(value | 0x80));
+				value >>= 7;
+			}
+			result.push_back(static_cast<uint8_t>(value));
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Encode the given @p values as varints of the differences between consecutive values.
+	 * @details The first value is encoded as difference to @c 0. Differences are computed modulo the range of
+	 * @p TValue, but only non-decreasing (e.g. sorted) values lead to small differences and thus a good compression.
+	 * This is the format decoded by CXXIter::fromDeltaVarint().
+	 * @param values Values to encode.
+	 * @return The encoded bytes.
+	 */
+	template<std::unsigned_integral TValue>
+	std::vector<uint8_t> encodeDeltaVarint(std::span<const TValue> values) {
+		std::vector<TValue> deltas(values.size());
+		TValue prev = 0;
+		for(size_t i = 0; i < values.size(); ++i) {
+			deltas[i] = static_cast<TValue>(values[i] - prev);
+			prev = values[i];
+		}
+		return encodeVarint<TValue>(deltas);
+	}
+
+	/** @private */
+	template<bool DELTA>
+	std::vector<uint8_t> encodeBitPackedImpl(std::span<const uint32_t> values) {
+		std::vector<uint8_t> result;
+		util::appendRaw<uint64_t>(result, values.size());
+		uint32_t prev = 0;
+		for(size_t blockStart = 0; blockStart < values.size(); blockStart += util::BITPACK_BLOCK_SIZE) {
+			const size_t blockCnt = std::min(util::BITPACK_BLOCK_SIZE, values.size() - blockStart);
+			const uint32_t base = prev;
+			std::array<uint32_t, util::BITPACK_BLOCK_SIZE> block = {};
+			uint32_t bitsUsed = 0;
+			for(size_t i = 0; i < blockCnt; ++i) {
+				if constexpr(DELTA) {
+					block[i] = values[blockStart + i] - prev;
+					prev = values[blockStart + i];
+				} else {
+					block[i] = values[blockStart + i];
+				}
+				bitsUsed |= block[i];
+			}
+			const uint8_t width = static_cast<uint8_t>(std::bit_width(bitsUsed));
+			result.push_back(width);
+			if constexpr(DELTA) { util::appendRaw<uint32_t>(result, base); }
+			util::bitPackBlock(block.data(), width, result);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief Encode the given @p values in blocks of 128 values, each packed with the minimum amount of bits
+	 * required for the largest value in the block.
+	 * @details Layout: The total amount of values (@c uint64_t), followed by the blocks. Each block consists of
+	 * its bit width (@c uint8_t), followed by <tt>16 * width</tt> bytes of packed values. The last block is
+	 * zero-padded to 128 values. Multi-byte fields use the native byte order.
+	 * This is the format decoded by CXXIter::fromBitPacked().
+	 * @param values Values to encode.
+	 * @return The encoded bytes.
+	 */
+	inline std::vector<uint8_t> encodeBitPacked(std::span<const uint32_t> values) {
+		return encodeBitPackedImpl<false>(values);
+	}
+
+	/**
+	 * @brief Encode the differences between consecutive @p values in bit-packed blocks of 128 values.
+	 * @details The layout is that of CXXIter::encodeBitPacked(), except that each block additionally stores the
+	 * value preceding its first value (@c uint32_t, directly after the bit width) as base, which allows skipping
+	 * blocks without decoding them. Only non-decreasing (e.g. sorted) values lead to a good compression.
+	 * This is the format decoded by CXXIter::fromDeltaBitPacked().
+	 * @param values Values to encode.
+	 * @return The encoded bytes.
+	 */
+	inline std::vector<uint8_t> encodeDeltaBitPacked(std::span<const uint32_t> values) {
+		return encodeBitPackedImpl<true>(values);
+	}
+
+
+
+	// ################################################################################################
+	// SOURCE (VARINT)
+	// ################################################################################################
+	/**
+	 * @brief CXXIter iterator source that lazily decodes varint-encoded (LEB128) integers from a byte buffer.
+	 * @details Decoding stops at the end of the buffer, or at a truncated last value.
+	 * @tparam TValue Type of the decoded values.
+	 * @tparam DELTA Whether the buffer contains the differences between consecutive values.
+	 */
+	template<std::unsigned_integral TValue, bool DELTA>
+	class SrcVarint : public IterApi<SrcVarint<TValue, DELTA>> {
+		friend struct trait::Iterator<SrcVarint<TValue, DELTA>>;
+	private:
+		const uint8_t* cur;
+		const uint8_t* end;
+		TValue prev = 0;
+	public:
+		constexpr SrcVarint(std::span<const uint8_t> input) : cur(input.data()), end(input.data() + input.size()) {}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<std::unsigned_integral TValue, bool DELTA>
+	struct trait::Iterator<SrcVarint<TValue, DELTA>> {
+		// CXXIter Interface
+		using Self = SrcVarint<TValue, DELTA>;
+		using Item = TValue;
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			TValue value = 0;
+			size_t shift = 0;
+			while(true) {
+				if(self.cur == self.end) [[unlikely]] { return {}; }
+				const uint8_t byte = *(self.cur++);
+				if(shift < std::numeric_limits<TValue>::digits) {
+					value |= static_cast<TValue>(static_cast<TValue>(byte & 0x7F) << shift);
+				}
+				if((byte & 0x80) == 0) { break; }
+				shift += 7;
+			}
+			if constexpr(DELTA) {
+				self.prev += value;
+				return self.prev;
+			} else {
+				return value;
+			}
+		}
+		// every value ends with exactly one byte that has the top bit cleared
+		static constexpr inline SizeHint sizeHint(const Self& self) {
+			const size_t remaining = std::count_if(self.cur, self.end, [](uint8_t byte) { return (byte & 0x80) == 0; });
+			return SizeHint(remaining, remaining);
+		}
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			if constexpr(DELTA) {
+				// differences have to be summed up
+				return util::advanceByPull(self, n);
+			} else {
+				// skip values by their last byte, without decoding them
+				size_t skipped = 0;
+				while(skipped < n && self.cur != self.end) {
+					if((*(self.cur++) & 0x80) == 0) { skipped += 1; }
+				}
+				return skipped;
+			}
+		}
+	};
+
+
+
+	// ################################################################################################
+	// SOURCE (BIT-PACKED)
+	// ################################################################################################
+	/**
+	 * @brief CXXIter iterator source that lazily decodes bit-packed @c uint32_t values (see CXXIter::encodeBitPacked()),
+	 * one block of 128 values at a time.
+	 * @details Only the current block is held in decoded form. advanceBy() skips whole blocks by only reading
+	 * their header. If the buffer is truncated, only its complete blocks are decoded - which is determined at
+	 * construction by walking the block headers, such that the reported size is always exact.
+	 * @tparam DELTA Whether the blocks contain the differences between consecutive values, which are decoded
+	 * using a prefix-sum starting at the block's base.
+	 */
+	template<bool DELTA>
+	class SrcBitPacked : public IterApi<SrcBitPacked<DELTA>> {
+		friend struct trait::Iterator<SrcBitPacked<DELTA>>;
+		friend struct trait::ExactSizeIterator<SrcBitPacked<DELTA>>;
+	private:
+		static constexpr size_t HEADER_SIZE = 1 + (DELTA ? sizeof(uint32_t) : 0);
+
+		const uint8_t* cur;
+		const uint8_t* end;
+		/** Amount of values in blocks that were not yet decoded */
+		size_t undecodedCnt = 0;
+		std::array<uint32_t, util::BITPACK_BLOCK_SIZE> block;
+		size_t blockPos = 0;
+		size_t blockCnt = 0;
+
+		/** Size of the block at @p blockStart in bytes, or 0 if it is truncated. */
+		size_t blockSizeAt(const uint8_t* blockStart) const {
+			if(static_cast<size_t>(end - blockStart) < HEADER_SIZE) { return 0; }
+			const size_t width = *blockStart;
+			const size_t blockSize = HEADER_SIZE + util::BITPACK_BLOCK_SIZE * width / 8;
+			if(width > 32 || static_cast<size_t>(end - blockStart) < blockSize) { return 0; }
+			return blockSize;
+		}
+		size_t currentBlockSize() const { return blockSizeAt(cur); }
+		size_t nextBlockCnt() const { return std::min(util::BITPACK_BLOCK_SIZE, undecodedCnt); }
+
+		/** Skip the block at cur without decoding it. */
+		bool skipBlock() {
+			const size_t blockSize = currentBlockSize();
+			if(blockSize == 0) [[unlikely]] { undecodedCnt = 0; return false; }
+			undecodedCnt -= nextBlockCnt();
+			cur += blockSize;
+			return true;
+		}
+		/** Decode the block at cur. */
+		bool decodeBlock() {
+			const size_t blockSize = currentBlockSize();
+			if(blockSize == 0) [[unlikely]] { undecodedCnt = 0; return false; }
+			const uint8_t width = cur[0];
+			util::bitUnpackBlock(cur + HEADER_SIZE, width, block.data());
+			if constexpr(DELTA) {
+				uint32_t value;
+				std::memcpy(&value, cur + 1, sizeof(value));
+				for(uint32_t& item : block) {
+					value += item;
+					item = value;
+				}
+			}
+			blockCnt = nextBlockCnt();
+			blockPos = 0;
+			undecodedCnt -= blockCnt;
+			cur += blockSize;
+			return true;
+		}
+	public:
+		SrcBitPacked(std::span<const uint8_t> input) : cur(input.data()), end(input.data() + input.size()) {
+			if(input.size() >= sizeof(uint64_t)) {
+				uint64_t totalCnt;
+				std::memcpy(&totalCnt, cur, sizeof(totalCnt));
+				cur += sizeof(uint64_t);
+				// clamp the amount of values from the header to the complete blocks in the buffer
+				for(const uint8_t* blockStart = cur; undecodedCnt < totalCnt; ) {
+					const size_t blockSize = blockSizeAt(blockStart);
+					if(blockSize == 0) { break; }
+					blockStart += blockSize;
+					undecodedCnt += static_cast<size_t>(std::min<uint64_t>(util::BITPACK_BLOCK_SIZE, totalCnt - undecodedCnt));
+				}
+			}
+		}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<bool DELTA>
+	struct trait::Iterator<SrcBitPacked<DELTA>> {
+		// CXXIter Interface
+		using Self = SrcBitPacked<DELTA>;
+		using Item = uint32_t;
+
+		static inline IterValue<Item> next(Self& self) {
+			if(self.blockPos == self.blockCnt) [[unlikely]] {
+				if(self.undecodedCnt == 0 || !self.decodeBlock()) { return {}; }
+			}
+			return self.block[self.blockPos++];
+		}
+		static inline SizeHint sizeHint(const Self& self) {
+			const size_t remaining = (self.blockCnt - self.blockPos) + self.undecodedCnt;
+			return SizeHint(remaining, remaining);
+		}
+		static inline size_t advanceBy(Self& self, size_t n) {
+			size_t skipped = std::min(n, self.blockCnt - self.blockPos);
+			self.blockPos += skipped;
+			while(skipped < n && self.undecodedCnt > 0) {
+				const size_t blockCnt = self.nextBlockCnt();
+				if(n - skipped >= blockCnt) {
+					if(!self.skipBlock()) { break; }
+					skipped += blockCnt;
+				} else {
+					if(!self.decodeBlock()) { break; }
+					self.blockPos = n - skipped;
+					skipped = n;
+				}
+			}
+			return skipped;
+		}
+	};
+	/** @private */
+	template<bool DELTA>
+	struct trait::ExactSizeIterator<SrcBitPacked<DELTA>> {
+		static inline size_t size(const SrcBitPacked<DELTA>& self) { return trait::Iterator<SrcBitPacked<DELTA>>::sizeHint(self).lowerBound; }
+	};
+
+}
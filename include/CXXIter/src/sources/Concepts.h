@@ -1,9 +1,30 @@
 #pragma once
 
+#include <span>
+#include <string_view>
+
 #include "../Traits.h"
 
 namespace CXXIter::concepts {
 
+	/** @private */
+	template<typename T>
+	inline constexpr bool is_contiguous_view_v = false;
+	/** @private */
+	template<typename T, size_t EXTENT>
+	inline constexpr bool is_contiguous_view_v<std::span<T, EXTENT>> = true;
+	/** @private */
+	template<typename TChar, typename TTraits>
+	inline constexpr bool is_contiguous_view_v<std::basic_string_view<TChar, TTraits>> = true;
+
+	/**
+		* @brief Concept that checks whether the given @p TView is a non-owning view onto contiguous memory
+		* (@c std::span or @c std::basic_string_view), which is iterated using CXXIter::SrcView instead of
+		* CXXIter's standard container sources.
+		*/
+	template<typename TView>
+	concept ContiguousView = is_contiguous_view_v<TView>;
+
 	/**
 		* @brief Concept that checks whether the given @p TContainer is supported by CXXIter's standard source
 		* classes CXXIter::SrcMov, CXXIter::SrcRef and CXXIter::SrcCRef.
@@ -66,4 +87,48 @@ namespace CXXIter::concepts {
 		{trait::Source<TContainer>::skipNBack(container, constIterState, n)} -> std::same_as<size_t>;
 	};
 
+	/**
+		 * @brief Concept that checks whether the given @p TContainer supports segmented iteration when using CXXIter's
+		 * standard source classes CXXIter::SrcMov, CXXIter::SrcRef and CXXIter::SrcCRef.
+		 * @details The concept does these checks by testing whether the optional segmented part in CXXIter::trait::Source
+		 * was properly provided by the specialization for the given @p TContainer type.
+		 *
+		 * @see CXXIter::Source for further details on this.
+		 */
+	template<typename TContainer>
+	concept SegmentedSourceContainer = SourceContainer<TContainer> && requires(
+		const TContainer& constContainer,
+		const typename trait::Source<TContainer>::IteratorState& iterState,
+		const typename trait::Source<TContainer>::ConstIteratorState& constIterState
+		) {
+		{trait::Source<TContainer>::segmentSize(constContainer, iterState)} -> std::same_as<size_t>;
+		{trait::Source<TContainer>::segmentSize(constContainer, constIterState)} -> std::same_as<size_t>;
+	};
+
+	/**
+		 * @brief Concept that checks whether the iteration state CXXIter::SrcRef keeps for the given @p TContainer is
+		 * a plain pair of the container's own iterators, and the container's storage can thus be modified in-place
+		 * through them.
+		 * @details This is the case for CXXIter's default CXXIter::trait::Source implementation.
+		 */
+	template<typename TContainer>
+	concept InPlaceSourceContainer = SourceContainer<TContainer> && requires(
+		typename trait::Source<TContainer>::IteratorState& iterState
+		) {
+		{iterState.left} -> std::same_as<typename TContainer::iterator&>;
+		{iterState.right} -> std::same_as<typename TContainer::iterator&>;
+	};
+
+	/**
+		 * @brief Concept that checks whether the given @p TContainer can be modified in-place through CXXIter::SrcRef
+		 * (see CXXIter::concepts::InPlaceSourceContainer), and supports the erasure of a range of items.
+		 */
+	template<typename TContainer>
+	concept InPlaceErasableSourceContainer = InPlaceSourceContainer<TContainer> && requires(
+		TContainer& container,
+		typename TContainer::iterator iter
+		) {
+		{container.erase(iter, iter)} -> std::same_as<typename TContainer::iterator>;
+	};
+
 }
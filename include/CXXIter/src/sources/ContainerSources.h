@@ -1,6 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <algorithm>
+#include <iterator>
+#include <span>
 
 #include "../Common.h"
 #include "Concepts.h"
@@ -22,6 +25,7 @@ namespace CXXIter {
 		friend struct trait::DoubleEndedIterator<SrcMov<TContainer>>;
 		friend struct trait::ExactSizeIterator<SrcMov<TContainer>>;
 		friend struct trait::ContiguousMemoryIterator<SrcMov<TContainer>>;
+		friend struct trait::SegmentedIterator<SrcMov<TContainer>>;
 		using Src = trait::Source<TContainer>;
 	private:
 		std::unique_ptr<TContainer> container;
@@ -74,6 +78,20 @@ namespace CXXIter {
 			return &trait::Source<TContainer>::peekNext(*self.container, self.iter);
 		}
 	};
+	/** @private */
+	template<typename TContainer>
+	requires concepts::SegmentedSourceContainer<TContainer>
+	struct trait::SegmentedIterator<SrcMov<TContainer>> {
+		using Src = trait::Source<TContainer>;
+		using Segment = std::span<std::remove_reference_t<typename SrcMov<TContainer>::Item>>;
+		static constexpr inline Segment nextSegment(SrcMov<TContainer>& self) {
+			const size_t segmentSize = Src::segmentSize(*self.container, self.iter);
+			if(segmentSize == 0) { return {}; }
+			auto* segmentStart = std::addressof(Src::peekNext(*self.container, self.iter));
+			Src::skipN(*self.container, self.iter, segmentSize);
+			return Segment(segmentStart, segmentSize);
+		}
+	};
 
 
 
@@ -94,12 +112,201 @@ namespace CXXIter {
 		friend struct trait::DoubleEndedIterator<SrcRef<TContainer>>;
 		friend struct trait::ExactSizeIterator<SrcRef<TContainer>>;
 		friend struct trait::ContiguousMemoryIterator<SrcRef<TContainer>>;
+		friend struct trait::SegmentedIterator<SrcRef<TContainer>>;
 		using Src = trait::Source<TContainer>;
 	private:
 		TContainer& container;
 		typename Src::IteratorState iter;
 	public:
 		SrcRef(TContainer& container) : container(container), iter(Src::initIterator(this->container)) {}
+
+		/**
+		 * @name In-Place Consumers
+		 * @details These consumers directly modify the storage of the borrowed container, for the range of
+		 * items that is still remaining in this iterator. In contrast to building a chain and collecting it
+		 * into a new container, they neither copy the items nor allocate a new container. (Only the stable
+		 * sort and partition variants may use a temporary buffer internally.)
+		 * @note These consume the iterator.
+		 */
+		//@{
+
+		/**
+		 * @brief Sorts the remaining items of this iterator in-place within the source container,
+		 * using the supplied @p compareFn.
+		 * @note This consumes the iterator.
+		 * @param compareFn Compare function used for the sorting of items.
+		 * @tparam STABLE If @c true, uses @c std::stable_sort internally, if @c false uses @c std::sort
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<float> input = {1.0f, 2.0f, 0.5f, 3.0f, -42.0f};
+		 * 	CXXIter::from(input).sortInPlace<false>([](const float& a, const float& b) { return (a > b); });
+		 * 	// input == {3.0f, 2.0f, 1.0f, 0.5f, -42.0f}
+		 * @endcode
+		 */
+		template<bool STABLE, typename TCompareFn>
+		requires concepts::InPlaceSourceContainer<TContainer> && std::random_access_iterator<typename TContainer::iterator>
+		constexpr void sortInPlace(TCompareFn compareFn) {
+			if constexpr(STABLE) {
+				std::stable_sort(iter.left, iter.right, compareFn);
+			} else {
+				std::sort(iter.left, iter.right, compareFn);
+			}
+			iter.left = iter.right;
+		}
+
+		/**
+		 * @brief Sorts the remaining items of this iterator in-place within the source container.
+		 * @note This consumes the iterator.
+		 * @tparam ORDER Decides the sort order.
+		 * @tparam STABLE If @c true, uses @c std::stable_sort internally, if @c false uses @c std::sort
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<float> input = {1.0f, 2.0f, 0.5f, 3.0f, -42.0f};
+		 * 	CXXIter::from(input).sortInPlace<CXXIter::ASCENDING>();
+		 * 	// input == {-42.0f, 0.5f, 1.0f, 2.0f, 3.0f}
+		 * @endcode
+		 */
+		template<SortOrder ORDER = SortOrder::ASCENDING, bool STABLE = false>
+		requires concepts::InPlaceSourceContainer<TContainer> && std::random_access_iterator<typename TContainer::iterator>
+		constexpr void sortInPlace() {
+			using Item = typename Src::Item;
+			sortInPlace<STABLE>([](const Item& a, const Item& b) {
+				if constexpr(ORDER == SortOrder::ASCENDING) {
+					return (a < b);
+				} else {
+					return (a > b);
+				}
+			});
+		}
+
+		/**
+		 * @brief Reorders the remaining items of this iterator in-place within the source container, such that
+		 * all items for which @p predicateFn returns @c true precede the items for which it returns @c false.
+		 * @note This consumes the iterator.
+		 * @param predicateFn Predicate deciding the partition an item belongs to.
+		 * @tparam STABLE If @c true, the relative order of the items within each partition is preserved
+		 * (uses @c std::stable_partition, which may allocate a temporary buffer), if @c false
+		 * uses @c std::partition
+		 * @return The amount of items for which @p predicateFn returned @c true.
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<int> input = {1, 2, 3, 4, 5, 6};
+		 * 	size_t evenCnt = CXXIter::from(input).partitionInPlace<true>([](int item) { return (item % 2 == 0); });
+		 * 	// evenCnt == 3
+		 * 	// input == {2, 4, 6, 1, 3, 5}
+		 * @endcode
+		 */
+		template<bool STABLE = false, typename TPredicateFn>
+		requires concepts::InPlaceSourceContainer<TContainer> && std::bidirectional_iterator<typename TContainer::iterator>
+		constexpr size_t partitionInPlace(TPredicateFn predicateFn) {
+			typename TContainer::iterator partitionPoint;
+			if constexpr(STABLE) {
+				partitionPoint = std::stable_partition(iter.left, iter.right, predicateFn);
+			} else {
+				partitionPoint = std::partition(iter.left, iter.right, predicateFn);
+			}
+			const size_t matchCnt = std::distance(iter.left, partitionPoint);
+			iter.left = iter.right;
+			return matchCnt;
+		}
+
+		/**
+		 * @brief Removes all remaining items of this iterator, for which @p predicateFn returns @c false, from the
+		 * source container. The relative order of the retained items is preserved.
+		 * @note This consumes the iterator.
+		 * @param predicateFn Predicate deciding whether an item is retained.
+		 * @return The amount of items that were removed from the source container.
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<int> input = {1, 2, 3, 4, 5, 6};
+		 * 	size_t removedCnt = CXXIter::from(input).retain([](int item) { return (item % 2 == 0); });
+		 * 	// removedCnt == 3
+		 * 	// input == {2, 4, 6}
+		 * @endcode
+		 */
+		template<typename TPredicateFn>
+		requires concepts::InPlaceErasableSourceContainer<TContainer>
+		constexpr size_t retain(TPredicateFn predicateFn) {
+			return eraseFromRemaining(std::remove_if(iter.left, iter.right, [&predicateFn](const auto& item) {
+				return !predicateFn(item);
+			}));
+		}
+
+		/**
+		 * @brief Removes all remaining items of this iterator that compare equal to @p value from the
+		 * source container. The relative order of the other items is preserved.
+		 * @note This consumes the iterator.
+		 * @param value Value to remove from the source container.
+		 * @return The amount of items that were removed from the source container.
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<int> input = {1, 2, 1, 3, 1};
+		 * 	size_t removedCnt = CXXIter::from(input).removeInPlace(1);
+		 * 	// removedCnt == 3
+		 * 	// input == {2, 3}
+		 * @endcode
+		 */
+		constexpr size_t removeInPlace(const typename Src::Item& value)
+		requires concepts::InPlaceErasableSourceContainer<TContainer> {
+			return eraseFromRemaining(std::remove(iter.left, iter.right, value));
+		}
+
+		/**
+		 * @brief Removes consecutive duplicates from the remaining items of this iterator in the source container.
+		 * Two items are considered duplicates, if @p compareFn returns @c true for them.
+		 * @note This consumes the iterator.
+		 * @param compareFn Function deciding whether two items are duplicates of each other.
+		 * @return The amount of items that were removed from the source container.
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<std::string> input = {"a", "A", "b", "c", "C", "c"};
+		 * 	size_t removedCnt = CXXIter::from(input).dedupInPlace([](const std::string& a, const std::string& b) {
+		 * 		return (std::tolower(a[0]) == std::tolower(b[0]));
+		 * 	});
+		 * 	// removedCnt == 3
+		 * 	// input == {"a", "b", "c"}
+		 * @endcode
+		 */
+		template<typename TCompareFn>
+		requires concepts::InPlaceErasableSourceContainer<TContainer>
+		constexpr size_t dedupInPlace(TCompareFn compareFn) {
+			return eraseFromRemaining(std::unique(iter.left, iter.right, compareFn));
+		}
+
+		/**
+		 * @brief Removes consecutive duplicates from the remaining items of this iterator in the source container.
+		 * @note This consumes the iterator.
+		 * @return The amount of items that were removed from the source container.
+		 *
+		 * Usage Example:
+		 * @code
+		 * 	std::vector<int> input = {1, 1, 2, 3, 3, 3, 1};
+		 * 	size_t removedCnt = CXXIter::from(input).dedupInPlace();
+		 * 	// removedCnt == 3
+		 * 	// input == {1, 2, 3, 1}
+		 * @endcode
+		 */
+		constexpr size_t dedupInPlace()
+		requires concepts::InPlaceErasableSourceContainer<TContainer> {
+			return eraseFromRemaining(std::unique(iter.left, iter.right));
+		}
+		//@}
+
+	private:
+		template<typename TContainerIterator>
+		constexpr size_t eraseFromRemaining(TContainerIterator newRight) {
+			const size_t removedCnt = std::distance(newRight, iter.right);
+			container.erase(newRight, iter.right);
+			// erasing invalidated the iteration state
+			iter.left = iter.right = container.end();
+			return removedCnt;
+		}
 	};
 	// ------------------------------------------------------------------------------------------------
 	/** @private */
@@ -146,6 +353,20 @@ namespace CXXIter {
 			return &trait::Source<TContainer>::peekNext(self.container, self.iter);
 		}
 	};
+	/** @private */
+	template<typename TContainer>
+	requires concepts::SegmentedSourceContainer<TContainer>
+	struct trait::SegmentedIterator<SrcRef<TContainer>> {
+		using Src = trait::Source<TContainer>;
+		using Segment = std::span<std::remove_reference_t<typename SrcRef<TContainer>::Item>>;
+		static constexpr inline Segment nextSegment(SrcRef<TContainer>& self) {
+			const size_t segmentSize = Src::segmentSize(self.container, self.iter);
+			if(segmentSize == 0) { return {}; }
+			auto* segmentStart = std::addressof(Src::peekNext(self.container, self.iter));
+			Src::skipN(self.container, self.iter, segmentSize);
+			return Segment(segmentStart, segmentSize);
+		}
+	};
 
 
 
@@ -165,6 +386,7 @@ namespace CXXIter {
 		friend struct trait::DoubleEndedIterator<SrcCRef<TContainer>>;
 		friend struct trait::ExactSizeIterator<SrcCRef<TContainer>>;
 		friend struct trait::ContiguousMemoryIterator<SrcCRef<TContainer>>;
+		friend struct trait::SegmentedIterator<SrcCRef<TContainer>>;
 		using Src = trait::Source<TContainer>;
 	private:
 		const TContainer& container;
@@ -217,5 +439,19 @@ namespace CXXIter {
 			return &trait::Source<TContainer>::peekNext(self.container, self.iter);
 		}
 	};
+	/** @private */
+	template<typename TContainer>
+	requires concepts::SegmentedSourceContainer<TContainer>
+	struct trait::SegmentedIterator<SrcCRef<TContainer>> {
+		using Src = trait::Source<TContainer>;
+		using Segment = std::span<std::remove_reference_t<typename SrcCRef<TContainer>::Item>>;
+		static constexpr inline Segment nextSegment(SrcCRef<TContainer>& self) {
+			const size_t segmentSize = Src::segmentSize(self.container, self.iter);
+			if(segmentSize == 0) { return {}; }
+			auto* segmentStart = std::addressof(Src::peekNext(self.container, self.iter));
+			Src::skipN(self.container, self.iter, segmentSize);
+			return Segment(segmentStart, segmentSize);
+		}
+	};
 
 }
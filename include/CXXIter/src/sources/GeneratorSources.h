@@ -2,8 +2,10 @@
 
 #include <cstdlib>
 #include <optional>
+#include <span>
 
 #include "../Common.h"
+#include "../Channel.h"
 #include "../util/TraitImpl.h"
 
 namespace CXXIter {
@@ -158,6 +160,37 @@ namespace CXXIter {
 
 
 
+	// ################################################################################################
+	// GENERATOR CHANNEL
+	// ################################################################################################
+	/** @private */
+	template<typename TItem>
+	class ChannelSource : public IterApi<ChannelSource<TItem>> {
+		friend struct trait::Iterator<ChannelSource<TItem>>;
+	private:
+		Channel<TItem>& channel;
+	public:
+		ChannelSource(Channel<TItem>& channel) : channel(channel) {}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TItem>
+	struct trait::Iterator<ChannelSource<TItem>> {
+		// CXXIter Interface
+		using Self = ChannelSource<TItem>;
+		using Item = TItem;
+
+		static inline IterValue<Item> next(Self& self) {
+			std::optional<TItem> item = self.channel.receive();
+			if(!item.has_value()) [[unlikely]] { return {}; }
+			return std::move(item.value());
+		}
+		static constexpr inline SizeHint sizeHint(const Self&) { return SizeHint(); }
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+
+
+
 #ifdef CXXITER_HAS_COROUTINE
 	// ################################################################################################
 	// COROUTINE GENERATOR
@@ -167,6 +200,7 @@ namespace CXXIter {
 	class CoroutineGenerator : public IterApi<CoroutineGenerator<TGenerator>> {
 		friend struct trait::Iterator<CoroutineGenerator<TGenerator>>;
 		friend struct trait::ExactSizeIterator<CoroutineGenerator<TGenerator>>;
+		friend struct trait::SegmentedIterator<CoroutineGenerator<TGenerator>>;
 	private:
 		TGenerator generator;
 	public:
@@ -186,6 +220,15 @@ namespace CXXIter {
 		static constexpr inline SizeHint sizeHint(const Self&) { return SizeHint(); }
 		static constexpr inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
 	};
+	/** @private */
+	template<typename TGenerator>
+	requires std::is_reference_v<typename TGenerator::value_type>
+	struct trait::SegmentedIterator<CoroutineGenerator<TGenerator>> {
+		using Segment = std::span<std::remove_reference_t<typename TGenerator::value_type>>;
+		static constexpr inline Segment nextSegment(CoroutineGenerator<TGenerator>& self) {
+			return self.generator.nextBatch();
+		}
+	};
 #endif
 
 }
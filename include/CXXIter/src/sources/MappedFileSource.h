@@ -0,0 +1,177 @@
+#pragma once
+
+#ifdef CXXITER_HAS_MMAP
+
+#include <cstdlib>
+#include <cerrno>
+#include <algorithm>
+#include <filesystem>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../Common.h"
+
+namespace CXXIter {
+
+	/**
+	 * @brief Access pattern hint passed to the kernel (@c madvise) for memory-mapped file sources.
+	 */
+	enum class MappedFileAdvice {
+		/** No special treatment (@c MADV_NORMAL). */
+		NORMAL,
+		/** Pages are accessed in sequential order - aggressive read-ahead (@c MADV_SEQUENTIAL). */
+		SEQUENTIAL,
+		/** Pages are accessed in random order - no read-ahead (@c MADV_RANDOM). */
+		RANDOM,
+		/** The whole file will be accessed soon - start reading it in (@c MADV_WILLNEED). */
+		WILLNEED
+	};
+
+	namespace util {
+		/**
+		 * @brief RAII wrapper around a read-only memory mapping of a whole file.
+		 * @details The mapping's address stays stable when an instance is moved.
+		 */
+		class MappedFile {
+			const std::byte* data = nullptr;
+			size_t size = 0;
+
+			static std::system_error lastError(const std::string& what, const std::filesystem::path& path) {
+				return std::system_error(errno, std::generic_category(), what + " " + path.string());
+			}
+		public:
+			/**
+			 * @brief Map the file at the given @p path into memory.
+			 * @throws std::system_error when opening, inspecting or mapping the file fails.
+			 */
+			MappedFile(const std::filesystem::path& path, MappedFileAdvice advice) {
+				int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+				if(fd < 0) { throw lastError("Failed to open", path); }
+				struct stat fileStat;
+				if(::fstat(fd, &fileStat) != 0) {
+					auto error = lastError("Failed to stat", path);
+					::close(fd);
+					throw error;
+				}
+				size = static_cast<size_t>(fileStat.st_size);
+				if(size > 0) {
+					void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+					if(mapping == MAP_FAILED) {
+						auto error = lastError("Failed to mmap", path);
+						::close(fd);
+						throw error;
+					}
+					data = static_cast<const std::byte*>(mapping);
+					// the advice is only a hint, failing to apply it is not an error
+					::madvise(mapping, size, toMAdvice(advice));
+				}
+				// the mapping keeps its own reference to the file
+				::close(fd);
+			}
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+			MappedFile(MappedFile&& o) : data(std::exchange(o.data, nullptr)), size(std::exchange(o.size, 0)) {}
+			MappedFile& operator=(MappedFile&& o) {
+				std::swap(data, o.data);
+				std::swap(size, o.size);
+				return *this;
+			}
+			~MappedFile() {
+				if(data != nullptr) { ::munmap(const_cast<std::byte*>(data), size); }
+			}
+
+			const std::byte* begin() const { return data; }
+			size_t byteSize() const { return size; }
+
+			static int toMAdvice(MappedFileAdvice advice) {
+				switch(advice) {
+					case MappedFileAdvice::SEQUENTIAL: return MADV_SEQUENTIAL;
+					case MappedFileAdvice::RANDOM: return MADV_RANDOM;
+					case MappedFileAdvice::WILLNEED: return MADV_WILLNEED;
+					default: return MADV_NORMAL;
+				}
+			}
+		};
+	}
+
+	// ################################################################################################
+	// SOURCE (MEMORY-MAPPED FILE)
+	// ################################################################################################
+
+	/**
+	 * @brief CXXIter iterator source that memory-maps a file, and passes const references to the
+	 * fixed-size binary records of type @p TRecord stored in it through the iterator.
+	 * @details No data is copied. Trailing bytes that do not form a complete record are ignored.
+	 */
+	template<typename TRecord>
+	requires std::is_trivially_copyable_v<TRecord>
+	class SrcMappedFile : public IterApi<SrcMappedFile<TRecord>> {
+		friend struct trait::Iterator<SrcMappedFile<TRecord>>;
+		friend struct trait::DoubleEndedIterator<SrcMappedFile<TRecord>>;
+		friend struct trait::ExactSizeIterator<SrcMappedFile<TRecord>>;
+		friend struct trait::ContiguousMemoryIterator<SrcMappedFile<TRecord>>;
+	private:
+		util::MappedFile file;
+		const TRecord* left;
+		const TRecord* right;
+	public:
+		SrcMappedFile(const std::filesystem::path& path, MappedFileAdvice advice) : file(path, advice) {
+			left = reinterpret_cast<const TRecord*>(file.begin());
+			right = left + (file.byteSize() / sizeof(TRecord));
+		}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TRecord>
+	struct trait::Iterator<SrcMappedFile<TRecord>> {
+		// CXXIter Interface
+		using Self = SrcMappedFile<TRecord>;
+		using Item = const TRecord&;
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return *(self.left++);
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) {
+			const size_t remaining = self.right - self.left;
+			return SizeHint(remaining, remaining);
+		}
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			const size_t skipN = std::min(n, static_cast<size_t>(self.right - self.left));
+			self.left += skipN;
+			return skipN;
+		}
+	};
+	/** @private */
+	template<typename TRecord>
+	struct trait::DoubleEndedIterator<SrcMappedFile<TRecord>> {
+		using Item = const TRecord&;
+
+		// CXXIter Interface
+		static constexpr inline IterValue<Item> nextBack(SrcMappedFile<TRecord>& self) {
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return *(--self.right);
+		}
+	};
+	/** @private */
+	template<typename TRecord>
+	struct trait::ExactSizeIterator<SrcMappedFile<TRecord>> {
+		static constexpr inline size_t size(const SrcMappedFile<TRecord>& self) { return self.right - self.left; }
+	};
+	/** @private */
+	template<typename TRecord>
+	struct trait::ContiguousMemoryIterator<SrcMappedFile<TRecord>> {
+		using ItemPtr = const TRecord*;
+		static constexpr inline ItemPtr currentPtr(SrcMappedFile<TRecord>& self) { return self.left; }
+	};
+
+}
+
+#endif
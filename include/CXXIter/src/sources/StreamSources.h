@@ -0,0 +1,241 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <cstddef>
+#include <algorithm>
+#include <istream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#ifdef CXXITER_HAS_POSIX_IO
+#include <cerrno>
+#include <system_error>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	namespace util {
+
+		// ################################################################################################
+		// BLOCK READERS
+		// ################################################################################################
+
+		/**
+		 * @brief Block reader that reads from a @c std::istream.
+		 */
+		class IStreamBlockReader {
+			std::istream* stream;
+		public:
+			IStreamBlockReader(std::istream& stream) : stream(&stream) {}
+
+			/**
+			 * @brief Read up to @p n bytes into @p dst.
+			 * @return The amount of bytes read. @c 0 signals the end of the stream.
+			 */
+			size_t read(char* dst, size_t n) {
+				stream->read(dst, static_cast<std::streamsize>(n));
+				return static_cast<size_t>(stream->gcount());
+			}
+		};
+
+#ifdef CXXITER_HAS_POSIX_IO
+		/**
+		 * @brief Block reader that reads from a (borrowed) POSIX file descriptor.
+		 * @details On construction, the kernel is advised of the sequential access pattern
+		 * (@c posix_fadvise), which enables aggressive read-ahead for the file.
+		 */
+		class FdBlockReader {
+			int fd;
+		public:
+			FdBlockReader(int fd) : fd(fd) {
+				// the advice is only a hint (and not supported on e.g. pipes), failing to apply it is not an error
+				::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+			}
+
+			/**
+			 * @brief Read up to @p n bytes into @p dst.
+			 * @return The amount of bytes read. @c 0 signals the end of the file.
+			 * @throws std::system_error when reading from the file descriptor fails.
+			 */
+			size_t read(char* dst, size_t n) {
+				while(true) {
+					ssize_t readCnt = ::read(fd, dst, n);
+					if(readCnt >= 0) [[likely]] { return static_cast<size_t>(readCnt); }
+					if(errno != EINTR) { throw std::system_error(errno, std::generic_category(), "Failed to read from fd"); }
+				}
+			}
+		};
+#endif
+
+		// ################################################################################################
+		// BLOCK BUFFER
+		// ################################################################################################
+
+		/**
+		 * @brief Buffer that pulls large blocks from the given @p TReader, to be consumed in small pieces.
+		 * @details The start of the buffer is aligned suitably for any fundamental type.
+		 */
+		template<typename TReader>
+		class BlockBuffer {
+			TReader reader;
+			std::vector<std::max_align_t> storage;
+			size_t left = 0;
+			size_t right = 0;
+			bool eof = false;
+
+			char* bytes() { return reinterpret_cast<char*>(storage.data()); }
+			size_t capacity() const { return storage.size() * sizeof(std::max_align_t); }
+		public:
+			BlockBuffer(TReader&& reader, size_t blockSize)
+				: reader(std::move(reader)), storage(std::max<size_t>(1, (blockSize + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t))) {}
+
+			/** @brief Bytes that were read, but not yet consumed. */
+			std::string_view pending() { return std::string_view(bytes() + left, right - left); }
+			/** @brief Mark the first @p n pending bytes as consumed. */
+			void consume(size_t n) { left += n; }
+			/** @brief Whether the reader reached its end. */
+			bool isEof() const { return eof; }
+
+			/**
+			 * @brief Read the next block from the reader.
+			 * @details Pending bytes (e.g. the beginning of a record that straddles two blocks) are moved to the
+			 * start of the buffer, and the rest of the buffer is filled from the reader. If the pending bytes
+			 * occupy the whole buffer, its capacity is doubled. This invalidates all views into the buffer.
+			 */
+			void refill() {
+				const size_t pendingSize = right - left;
+				if(left > 0) {
+					std::memmove(bytes(), bytes() + left, pendingSize);
+					left = 0;
+					right = pendingSize;
+				}
+				if(right == capacity()) { storage.resize(storage.size() * 2); }
+				const size_t readCnt = reader.read(bytes() + right, capacity() - right);
+				if(readCnt == 0) { eof = true; }
+				right += readCnt;
+			}
+		};
+
+	}
+
+	// ################################################################################################
+	// SOURCE (STREAM SPLITTER)
+	// ################################################################################################
+	/**
+	 * @brief CXXIter iterator source that reads large blocks from a stream, and splits them at a delimiter
+	 * character, passing copies of the records as @c std::string through the iterator.
+	 * @details Records straddling two blocks are moved to the front of the buffer before the next block is
+	 * read, such that every record is located within one contiguous piece of the buffer. Records that do not
+	 * fit into a block grow the buffer. The records are copied out of the block, since the block is overwritten
+	 * by later reads.
+	 * @tparam LINES If @c true, this splits at line-breaks: A trailing @c '\\r' is stripped from each line, and a
+	 * trailing line-break does not produce an empty last line. Otherwise, a trailing delimiter (or an empty
+	 * stream) produces an empty last record. This matches the semantics of CXXIter::StringSplitter.
+	 */
+	template<typename TReader, bool LINES>
+	class StreamSplitter : public IterApi<StreamSplitter<TReader, LINES>> {
+		friend struct trait::Iterator<StreamSplitter<TReader, LINES>>;
+	private:
+		util::BlockBuffer<TReader> buffer;
+		char delimiter;
+		bool finished = false;
+	public:
+		StreamSplitter(TReader&& reader, char delimiter, size_t blockSize)
+			: buffer(std::move(reader), blockSize), delimiter(delimiter) {}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TReader, bool LINES>
+	struct trait::Iterator<StreamSplitter<TReader, LINES>> {
+		// CXXIter Interface
+		using Self = StreamSplitter<TReader, LINES>;
+		using Item = std::string;
+
+		static inline IterValue<Item> next(Self& self) {
+			if(self.finished) [[unlikely]] { return {}; }
+			while(true) {
+				std::string_view pending = self.buffer.pending();
+				const char* recordEnd = nullptr;
+				if(!pending.empty()) {
+					recordEnd = static_cast<const char*>(std::memchr(pending.data(), self.delimiter, pending.size()));
+				}
+				if(recordEnd != nullptr) [[likely]] {
+					std::string_view record(pending.data(), recordEnd - pending.data());
+					self.buffer.consume(record.size() + 1);
+					return stripRecord(record);
+				}
+				if(self.buffer.isEof()) [[unlikely]] {
+					// last record (behind the last delimiter) - for lines, an empty one is not a line of its own
+					self.finished = true;
+					if(LINES && pending.empty()) { return {}; }
+					self.buffer.consume(pending.size());
+					return stripRecord(pending);
+				}
+				self.buffer.refill();
+			}
+		}
+		static inline std::string stripRecord(std::string_view record) {
+			if constexpr(LINES) {
+				if(!record.empty() && record.back() == '\r') { record.remove_suffix(1); }
+			}
+			return std::string(record);
+		}
+		static inline SizeHint sizeHint(const Self&) { return SizeHint(); }
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+
+
+
+	// ################################################################################################
+	// SOURCE (STREAM RECORDS)
+	// ################################################################################################
+	/**
+	 * @brief CXXIter iterator source that reads large blocks from a stream, and passes copies of the
+	 * fixed-size binary records of type @p TRecord in the current block through the iterator.
+	 * @details Records straddling two blocks are moved to the front of the buffer before the next block is
+	 * read. The records are copied out of the block, since the block is overwritten by later reads.
+	 * Trailing bytes at the end of the stream that do not form a complete record are ignored.
+	 */
+	template<typename TReader, typename TRecord>
+	requires std::is_trivially_copyable_v<TRecord> && std::is_default_constructible_v<TRecord>
+	class StreamRecords : public IterApi<StreamRecords<TReader, TRecord>> {
+		friend struct trait::Iterator<StreamRecords<TReader, TRecord>>;
+	private:
+		util::BlockBuffer<TReader> buffer;
+	public:
+		StreamRecords(TReader&& reader, size_t blockSize) : buffer(std::move(reader), std::max(blockSize, sizeof(TRecord))) {}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TReader, typename TRecord>
+	struct trait::Iterator<StreamRecords<TReader, TRecord>> {
+		// CXXIter Interface
+		using Self = StreamRecords<TReader, TRecord>;
+		using Item = TRecord;
+
+		static inline IterValue<Item> next(Self& self) {
+			while(true) {
+				std::string_view pending = self.buffer.pending();
+				if(pending.size() >= sizeof(TRecord)) [[likely]] {
+					TRecord record;
+					std::memcpy(&record, pending.data(), sizeof(TRecord));
+					self.buffer.consume(sizeof(TRecord));
+					return record;
+				}
+				if(self.buffer.isEof()) [[unlikely]] { return {}; }
+				self.buffer.refill();
+			}
+		}
+		static inline SizeHint sizeHint(const Self&) { return SizeHint(); }
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+
+}
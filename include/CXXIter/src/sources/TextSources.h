@@ -0,0 +1,271 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Common.h"
+#include "../util/TraitImpl.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// SOURCE (STRING SPLITTER)
+	// ################################################################################################
+	/**
+	 * @brief CXXIter iterator source that splits a string at a delimiter character, passing views to
+	 * the parts into the underlying buffer through the iterator.
+	 * @details The delimiters are searched using @c memchr, which is vectorized by all common C libraries.
+	 * @tparam LINES If @c true, this splits at line-breaks: A trailing @c '\\r' is stripped from each line,
+	 * and a trailing line-break does not produce an empty last line.
+	 */
+	template<bool LINES>
+	class StringSplitter : public IterApi<StringSplitter<LINES>> {
+		friend struct trait::Iterator<StringSplitter<LINES>>;
+	private:
+		const char* cur;
+		const char* end;
+		char delimiter;
+		bool finished = false;
+	public:
+		constexpr StringSplitter(std::string_view input, char delimiter)
+			: cur(input.data()), end(input.data() + input.size()), delimiter(delimiter) {}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<bool LINES>
+	struct trait::Iterator<StringSplitter<LINES>> {
+		// CXXIter Interface
+		using Self = StringSplitter<LINES>;
+		using Item = std::string_view;
+
+		static inline IterValue<Item> next(Self& self) {
+			if(self.finished) [[unlikely]] { return {}; }
+			if constexpr(LINES) {
+				if(self.cur == self.end) [[unlikely]] {
+					self.finished = true;
+					return {};
+				}
+			}
+			const char* partStart = self.cur;
+			const char* partEnd = nullptr;
+			if(self.cur != self.end) [[likely]] {
+				partEnd = static_cast<const char*>(std::memchr(self.cur, self.delimiter, self.end - self.cur));
+			}
+			if(partEnd == nullptr) [[unlikely]] {
+				partEnd = self.end;
+				self.cur = self.end;
+				self.finished = true;
+			} else {
+				self.cur = partEnd + 1;
+			}
+			if constexpr(LINES) {
+				if(partEnd != partStart && *(partEnd - 1) == '\r') { partEnd -= 1; }
+			}
+			return std::string_view(partStart, partEnd - partStart);
+		}
+		// counts the remaining delimiters (single vectorized pass over the buffer) to report an exact size
+		static inline SizeHint sizeHint(const Self& self) {
+			if(self.finished) { return SizeHint(0, 0); }
+			size_t remaining = std::count(self.cur, self.end, self.delimiter);
+			if constexpr(LINES) {
+				// a trailing line without line-break is a line of its own
+				if(self.cur != self.end && *(self.end - 1) != self.delimiter) { remaining += 1; }
+			} else {
+				remaining += 1;
+			}
+			return SizeHint(remaining, remaining);
+		}
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+
+
+
+
+	// ################################################################################################
+	// SOURCE (CSV)
+	// ################################################################################################
+
+	/**
+	 * @brief Options for the delimited-text sources CXXIter::fromCsv() and CXXIter::fromTsv().
+	 */
+	struct CsvOptions {
+		/** Character separating the fields of a record. */
+		char separator = ',';
+		/** Character used to quote fields, which may then contain separators, line-breaks and doubled quotes. */
+		char quote = '"';
+		/** Whether the first record is a header, and should be skipped. */
+		bool skipHeader = false;
+	};
+
+	/**
+	 * @brief Record yielded by the delimited-text sources CXXIter::fromCsv() and CXXIter::fromTsv().
+	 * @details The fields are views into the input buffer. For quoted fields, the views exclude the surrounding
+	 * quotes. Doubled quotes within quoted fields are not unescaped, use unescape() for that.
+	 */
+	class CsvRecord {
+		template<bool> friend class CsvReader;
+		std::vector<std::string_view> fields;
+	public:
+		/** @brief Amount of fields in this record. */
+		size_t size() const { return fields.size(); }
+		/** @brief Get the field with the given @p idx. */
+		std::string_view operator[](size_t idx) const { return fields[idx]; }
+		/** @brief Get the field with the given @p idx. @throws std::out_of_range if @p idx is out of range. */
+		std::string_view at(size_t idx) const { return fields.at(idx); }
+		auto begin() const { return fields.begin(); }
+		auto end() const { return fields.end(); }
+		bool operator==(const CsvRecord& o) const = default;
+
+		/**
+		 * @brief Unescape doubled quotes in the given @p field.
+		 * @return A copy of @p field, with each occurence of two consecutive @p quote characters replaced by one.
+		 */
+		static std::string unescape(std::string_view field, char quote = '"') {
+			std::string result;
+			result.reserve(field.size());
+			for(size_t i = 0; i < field.size(); ++i) {
+				result.push_back(field[i]);
+				if(field[i] == quote && i + 1 < field.size() && field[i + 1] == quote) { i += 1; }
+			}
+			return result;
+		}
+	};
+
+	/**
+	 * @brief CXXIter iterator source that parses delimited text (such as CSV or TSV), passing a const reference to
+	 * the current record through the iterator.
+	 * @details The record is reused for every row, so no allocation takes place per record once its field
+	 * storage has grown to the amount of columns. The record is only valid until the next element is requested.
+	 *
+	 * Records are located using @c memchr for the line-break. If a record does not contain the quote character
+	 * (which is again checked using @c memchr), it is split at separators using @c memchr. Only records containing
+	 * quotes are parsed character by character.
+	 * @tparam PROJECTION Whether only a selection of the columns is stored in the yielded records.
+	 */
+	template<bool PROJECTION>
+	class CsvReader : public IterApi<CsvReader<PROJECTION>> {
+		friend struct trait::Iterator<CsvReader<PROJECTION>>;
+	private:
+		static constexpr size_t SKIP_COLUMN = static_cast<size_t>(-1);
+
+		const char* cur;
+		const char* end;
+		char separator;
+		char quote;
+		/** Maps each input column to its slot in the projected record (or SKIP_COLUMN) */
+		std::vector<size_t> columnSlots;
+		size_t projectedColumnCnt = 0;
+		CsvRecord record;
+
+		constexpr void addField(size_t columnIdx, std::string_view field) {
+			if constexpr(PROJECTION) {
+				if(columnIdx < columnSlots.size() && columnSlots[columnIdx] != SKIP_COLUMN) {
+					record.fields[columnSlots[columnIdx]] = field;
+				}
+			} else {
+				record.fields.push_back(field);
+			}
+		}
+
+		/** Parse the unquoted record in [recordStart, recordEnd) */
+		constexpr void parseSimple(const char* recordStart, const char* recordEnd) {
+			size_t columnIdx = 0;
+			while(true) {
+				const char* fieldEnd = static_cast<const char*>(std::memchr(recordStart, separator, recordEnd - recordStart));
+				if(fieldEnd == nullptr) {
+					addField(columnIdx, std::string_view(recordStart, recordEnd - recordStart));
+					return;
+				}
+				addField(columnIdx++, std::string_view(recordStart, fieldEnd - recordStart));
+				recordStart = fieldEnd + 1;
+			}
+		}
+
+		/** Parse the record starting at pos, which contains quotes. Returns the position after the record. */
+		constexpr const char* parseQuoted(const char* pos) {
+			size_t columnIdx = 0;
+			while(true) {
+				std::string_view field;
+				if(pos != end && *pos == quote) {
+					const char* fieldStart = ++pos;
+					while(true) {
+						const char* quotePos = static_cast<const char*>(std::memchr(pos, quote, end - pos));
+						if(quotePos == nullptr) { pos = end; break; } // unterminated quote: field extends to the end
+						if(quotePos + 1 != end && quotePos[1] == quote) { pos = quotePos + 2; continue; }
+						pos = quotePos;
+						break;
+					}
+					field = std::string_view(fieldStart, pos - fieldStart);
+					if(pos != end) { pos += 1; } // closing quote
+					// ignore anything between closing quote and the next separator / line-break
+					while(pos != end && *pos != separator && *pos != '\n') { pos += 1; }
+				} else {
+					const char* fieldStart = pos;
+					while(pos != end && *pos != separator && *pos != '\n') { pos += 1; }
+					field = std::string_view(fieldStart, pos - fieldStart);
+					if(pos != end && *pos == '\n' && !field.empty() && field.back() == '\r') { field.remove_suffix(1); }
+				}
+				addField(columnIdx++, field);
+				if(pos == end) { return end; }
+				if(*(pos++) == '\n') { return pos; }
+			}
+		}
+		/** Parse the next record into record. Returns false if there was none left. */
+		constexpr bool parseNext() {
+			if(cur == end) [[unlikely]] { return false; }
+			if constexpr(PROJECTION) {
+				record.fields.assign(projectedColumnCnt, std::string_view());
+			} else {
+				record.fields.clear();
+			}
+
+			const char* recordEnd = static_cast<const char*>(std::memchr(cur, '\n', end - cur));
+			const char* nextRecord = end;
+			if(recordEnd == nullptr) {
+				recordEnd = end;
+			} else {
+				nextRecord = recordEnd + 1;
+			}
+			if(std::memchr(cur, quote, recordEnd - cur) == nullptr) [[likely]] {
+				if(recordEnd != cur && *(recordEnd - 1) == '\r') { recordEnd -= 1; }
+				parseSimple(cur, recordEnd);
+				cur = nextRecord;
+			} else {
+				cur = parseQuoted(cur);
+			}
+			return true;
+		}
+	public:
+		CsvReader(std::string_view input, const CsvOptions& options, const std::vector<size_t>& columns = {})
+			: cur(input.data()), end(input.data() + input.size()), separator(options.separator), quote(options.quote) {
+			if constexpr(PROJECTION) {
+				projectedColumnCnt = columns.size();
+				for(size_t slot = 0; slot < columns.size(); ++slot) {
+					if(columns[slot] >= columnSlots.size()) { columnSlots.resize(columns[slot] + 1, SKIP_COLUMN); }
+					columnSlots[columns[slot]] = slot;
+				}
+			}
+			if(options.skipHeader) { parseNext(); }
+		}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<bool PROJECTION>
+	struct trait::Iterator<CsvReader<PROJECTION>> {
+		// CXXIter Interface
+		using Self = CsvReader<PROJECTION>;
+		using Item = const CsvRecord&;
+
+		static inline IterValue<Item> next(Self& self) {
+			if(!self.parseNext()) [[unlikely]] { return {}; }
+			return self.record;
+		}
+		static inline SizeHint sizeHint(const Self&) { return SizeHint(); }
+		static inline size_t advanceBy(Self& self, size_t n) { return util::advanceByPull(self, n); }
+	};
+
+}
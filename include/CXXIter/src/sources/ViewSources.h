@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstdlib>
+#include <algorithm>
+#include <span>
+
+#include "../Common.h"
+
+namespace CXXIter {
+
+	// ################################################################################################
+	// SOURCE (VIEW)
+	// ################################################################################################
+
+	/**
+	 * @brief CXXIter iterator source that passes references to the items of a non-owning view onto
+	 * contiguous memory (such as @c std::span, @c std::string_view or a C array) through the iterator.
+	 * @details In contrast to CXXIter::SrcRef and CXXIter::SrcCRef, this does not store a reference to the
+	 * view, but only a pointer range into the viewed memory. It thus never allocates, and the view itself does
+	 * not have to outlive the iterator - only the memory it views does.
+	 * @tparam TItem Type of the viewed items. If this is const, const references are passed through the iterator.
+	 */
+	template<typename TItem>
+	class SrcView : public IterApi<SrcView<TItem>> {
+		friend struct trait::Iterator<SrcView<TItem>>;
+		friend struct trait::DoubleEndedIterator<SrcView<TItem>>;
+		friend struct trait::ExactSizeIterator<SrcView<TItem>>;
+		friend struct trait::ContiguousMemoryIterator<SrcView<TItem>>;
+		friend struct trait::SegmentedIterator<SrcView<TItem>>;
+	private:
+		TItem* left;
+		TItem* right;
+	public:
+		constexpr SrcView(TItem* data, size_t size) : left(data), right(data + size) {}
+	};
+	// ------------------------------------------------------------------------------------------------
+	/** @private */
+	template<typename TItem>
+	struct trait::Iterator<SrcView<TItem>> {
+		// CXXIter Interface
+		using Self = SrcView<TItem>;
+		using Item = TItem&;
+
+		static constexpr inline IterValue<Item> next(Self& self) {
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return *(self.left++);
+		}
+		static constexpr inline SizeHint sizeHint(const Self& self) {
+			const size_t remaining = self.right - self.left;
+			return SizeHint(remaining, remaining);
+		}
+		static constexpr inline size_t advanceBy(Self& self, size_t n) {
+			const size_t skipN = std::min(n, static_cast<size_t>(self.right - self.left));
+			self.left += skipN;
+			return skipN;
+		}
+	};
+	/** @private */
+	template<typename TItem>
+	struct trait::DoubleEndedIterator<SrcView<TItem>> {
+		// CXXIter Interface
+		static constexpr inline IterValue<TItem&> nextBack(SrcView<TItem>& self) {
+			if(self.left == self.right) [[unlikely]] { return {}; }
+			return *(--self.right);
+		}
+	};
+	/** @private */
+	template<typename TItem>
+	struct trait::ExactSizeIterator<SrcView<TItem>> {
+		static constexpr inline size_t size(const SrcView<TItem>& self) { return self.right - self.left; }
+	};
+	/** @private */
+	template<typename TItem>
+	struct trait::ContiguousMemoryIterator<SrcView<TItem>> {
+		using ItemPtr = TItem*;
+		static constexpr inline ItemPtr currentPtr(SrcView<TItem>& self) { return self.left; }
+	};
+	/** @private */
+	template<typename TItem>
+	struct trait::SegmentedIterator<SrcView<TItem>> {
+		using Segment = std::span<TItem>;
+		static constexpr inline Segment nextSegment(SrcView<TItem>& self) {
+			Segment segment(self.left, self.right);
+			self.left = self.right;
+			return segment;
+		}
+	};
+
+}
@@ -97,6 +97,14 @@ namespace CXXIter::util {
 		template<template<typename...> typename TContainer, typename TItem, typename... TContainerArgs>
 		concept InsertableContainerTemplate = InsertableContainer<TContainer<TItem, TContainerArgs...>, TItem>;
 
+		/**
+		* @brief Concept enforcing a container that supports appending a range of items given by iterators of type
+		* @p TInputIterator at once, like @c std::vector.
+		*/
+		template<typename TContainer, typename TInputIterator>
+		concept RangeInsertableContainer = requires(TContainer& container, TInputIterator iter) {
+			container.insert(container.end(), iter, iter);
+		};
 		/**
 		* @brief Concept enforcing an associative container like @c std::map.
 		*/
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstddef>
+#include <array>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace CXXIter::util {
+
+	// ################################################################################################
+	// COROUTINE FRAME POOL
+	// ################################################################################################
+
+	/**
+	 * @brief Thread-local pool for coroutine frames.
+	 * @details Frames are grouped into size classes. Freed frames are kept on a free-list per size class
+	 * (up to a limit), and are handed out again for the next frame of the same size class. Since the frames
+	 * of one coroutine function always have the same size, repeatedly creating short-lived coroutines (such
+	 * as done by CXXIter::IterApi::generateFrom()) does not hit the heap after the first frame.
+	 * Frames freed on a different thread than the one they were allocated on are cached on the freeing thread.
+	 * Frames allocated or freed after the thread's free-lists were destroyed (e.g. by a generator that is destroyed
+	 * by another thread-local or static destructor) bypass the pool.
+	 */
+	class CoroutineFramePool {
+		/** Granularity of the size classes */
+		static constexpr size_t SIZE_CLASS_GRANULARITY = 64;
+		/** Frames larger than this are not pooled */
+		static constexpr size_t MAX_POOLED_SIZE = 4096;
+		/** Maximum amount of free frames kept per size class */
+		static constexpr size_t MAX_FREE_PER_CLASS = 64;
+		static constexpr size_t SIZE_CLASS_CNT = MAX_POOLED_SIZE / SIZE_CLASS_GRANULARITY;
+
+		struct FreeFrame {
+			FreeFrame* next;
+		};
+		struct FreeLists {
+			std::array<FreeFrame*, SIZE_CLASS_CNT> heads = {};
+			std::array<size_t, SIZE_CLASS_CNT> counts = {};
+
+			~FreeLists() {
+				freeListsDestroyed = true;
+				for(FreeFrame* head : heads) {
+					while(head != nullptr) {
+						::operator delete(std::exchange(head, head->next));
+					}
+				}
+			}
+		};
+		/** Whether the free-lists of this thread were destroyed. Trivially destructible, so it outlives them. */
+		static inline thread_local bool freeListsDestroyed = false;
+		/** The free-lists of this thread, or @c nullptr if they were already destroyed. */
+		static FreeLists* freeLists() {
+			if(freeListsDestroyed) [[unlikely]] { return nullptr; }
+			thread_local FreeLists lists;
+			return &lists;
+		}
+		static constexpr size_t sizeClass(size_t size) { return (size - 1) / SIZE_CLASS_GRANULARITY; }
+
+	public:
+		/**
+		 * @brief Allocate a frame of (at least) @p size bytes, with the default @c new alignment.
+		 */
+		static void* allocate(size_t size) {
+			if(size == 0 || size > MAX_POOLED_SIZE) [[unlikely]] { return ::operator new(size); }
+			const size_t cls = sizeClass(size);
+			FreeLists* lists = freeLists();
+			if(lists == nullptr) [[unlikely]] { return ::operator new((cls + 1) * SIZE_CLASS_GRANULARITY); }
+			if(FreeFrame* frame = lists->heads[cls]; frame != nullptr) [[likely]] {
+				lists->heads[cls] = frame->next;
+				lists->counts[cls] -= 1;
+				return frame;
+			}
+			return ::operator new((cls + 1) * SIZE_CLASS_GRANULARITY);
+		}
+
+		/**
+		 * @brief Return the frame at @p ptr, that was allocated using allocate() with the same @p size, to the pool.
+		 */
+		static void deallocate(void* ptr, size_t size) noexcept {
+			if(size == 0 || size > MAX_POOLED_SIZE) [[unlikely]] { return ::operator delete(ptr); }
+			const size_t cls = sizeClass(size);
+			FreeLists* lists = freeLists();
+			if(lists == nullptr || lists->counts[cls] == MAX_FREE_PER_CLASS) [[unlikely]] { return ::operator delete(ptr); }
+			lists->heads[cls] = ::new(ptr) FreeFrame{lists->heads[cls]};
+			lists->counts[cls] += 1;
+		}
+	};
+
+	// ################################################################################################
+	// COROUTINE FRAME ALLOCATION
+	// ################################################################################################
+
+	/**
+	 * @brief Allocation functions for coroutine frames, to be used by the @c operator @c new / @c operator @c delete
+	 * of a coroutine's promise type.
+	 * @details Frames are either allocated from the CXXIter::util::CoroutineFramePool, or from a user-supplied allocator.
+	 * To allow deallocation without knowing which was used, every frame is followed by a trailer, consisting of a
+	 * pointer to the matching deallocation function, and (if used) a copy of the allocator.
+	 */
+	class CoroutineFrameAllocator {
+		using DeallocateFn = void(*)(void* ptr, size_t frameSize);
+
+		/** Storage unit used to allocate frames from user-supplied allocators, to keep the default @c new alignment */
+		struct alignas(__STDCPP_DEFAULT_NEW_ALIGNMENT__) FrameUnit {
+			std::byte bytes[__STDCPP_DEFAULT_NEW_ALIGNMENT__];
+		};
+
+		static constexpr size_t alignUp(size_t size, size_t alignment) { return (size + alignment - 1) & ~(alignment - 1); }
+		static constexpr size_t deallocateFnOffset(size_t frameSize) { return alignUp(frameSize, alignof(DeallocateFn)); }
+		template<typename TAlloc>
+		static constexpr size_t allocatorOffset(size_t frameSize) {
+			return alignUp(deallocateFnOffset(frameSize) + sizeof(DeallocateFn), alignof(TAlloc));
+		}
+		template<typename TAlloc>
+		static constexpr size_t unitCnt(size_t frameSize) {
+			return alignUp(allocatorOffset<TAlloc>(frameSize) + sizeof(TAlloc), sizeof(FrameUnit)) / sizeof(FrameUnit);
+		}
+
+		static void setDeallocateFn(void* ptr, size_t frameSize, DeallocateFn deallocateFn) {
+			::new(static_cast<std::byte*>(ptr) + deallocateFnOffset(frameSize)) DeallocateFn(deallocateFn);
+		}
+
+		static void deallocatePooled(void* ptr, size_t frameSize) {
+			CoroutineFramePool::deallocate(ptr, deallocateFnOffset(frameSize) + sizeof(DeallocateFn));
+		}
+		template<typename TAlloc>
+		static void deallocateWithAllocator(void* ptr, size_t frameSize) {
+			using TUnitAlloc = typename std::allocator_traits<TAlloc>::template rebind_alloc<FrameUnit>;
+			TAlloc* storedAlloc = std::launder(reinterpret_cast<TAlloc*>(static_cast<std::byte*>(ptr) + allocatorOffset<TAlloc>(frameSize)));
+			TUnitAlloc unitAlloc(std::move(*storedAlloc));
+			std::destroy_at(storedAlloc);
+			std::allocator_traits<TUnitAlloc>::deallocate(unitAlloc, static_cast<FrameUnit*>(ptr), unitCnt<TAlloc>(frameSize));
+		}
+
+		template<typename TAlloc>
+		static void* allocateWithAllocator(size_t frameSize, const void* allocPtr) {
+			const TAlloc& alloc = *static_cast<const TAlloc*>(allocPtr);
+			using TUnitAlloc = typename std::allocator_traits<TAlloc>::template rebind_alloc<FrameUnit>;
+			TUnitAlloc unitAlloc(alloc);
+			void* ptr = std::allocator_traits<TUnitAlloc>::allocate(unitAlloc, unitCnt<TAlloc>(frameSize));
+			::new(static_cast<std::byte*>(ptr) + allocatorOffset<TAlloc>(frameSize)) TAlloc(alloc);
+			setDeallocateFn(ptr, frameSize, &deallocateWithAllocator<TAlloc>);
+			return ptr;
+		}
+
+	public:
+		/**
+		 * @brief User-supplied allocator, that is used for all coroutine frames allocated on the current thread
+		 * while it is installed. See CXXIter::GeneratorAllocatorScope.
+		 */
+		struct Scope {
+			void* (*allocate)(size_t frameSize, const void* allocPtr);
+			const void* allocPtr;
+			Scope* previous;
+		};
+		/**
+		 * @brief The innermost Scope currently installed on this thread, or @c nullptr.
+		 */
+		static Scope*& currentScope() {
+			thread_local Scope* scope = nullptr;
+			return scope;
+		}
+		/**
+		 * @brief Create a Scope for the given allocator @p alloc.
+		 */
+		template<typename TAlloc>
+		static Scope makeScope(const TAlloc& alloc) { return Scope{&allocateWithAllocator<TAlloc>, &alloc, nullptr}; }
+
+		/**
+		 * @brief Allocate a coroutine frame of @p frameSize bytes.
+		 * @details The frame is allocated from the allocator of the current Scope, if any. Otherwise, it is allocated from
+		 * the thread-local CXXIter::util::CoroutineFramePool. In the former case, a copy of the allocator is stored alongside
+		 * the frame, and used to deallocate it.
+		 */
+		static void* allocate(size_t frameSize) {
+			if(const Scope* scope = currentScope(); scope != nullptr) [[unlikely]] {
+				return scope->allocate(frameSize, scope->allocPtr);
+			}
+			void* ptr = CoroutineFramePool::allocate(deallocateFnOffset(frameSize) + sizeof(DeallocateFn));
+			setDeallocateFn(ptr, frameSize, &deallocatePooled);
+			return ptr;
+		}
+
+		/**
+		 * @brief Deallocate the coroutine frame at @p ptr with the given @p frameSize, that was allocated using allocate().
+		 */
+		static void deallocate(void* ptr, size_t frameSize) noexcept {
+			DeallocateFn deallocateFn = *std::launder(reinterpret_cast<DeallocateFn*>(static_cast<std::byte*>(ptr) + deallocateFnOffset(frameSize)));
+			deallocateFn(ptr, frameSize);
+		}
+	};
+
+}
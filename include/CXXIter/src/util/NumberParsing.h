@@ -0,0 +1,119 @@
+#pragma once
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+#include "Constraints.h"
+
+namespace CXXIter::util {
+
+	/**
+	 * @brief Get a @c std::string_view of the given @p input, which is either convertible to one, or a
+	 * @c std::reference_wrapper to something convertible to one.
+	 */
+	template<typename TInput>
+	constexpr std::string_view asStringView(const TInput& input) {
+		if constexpr(is_template_instance_v<TInput, std::reference_wrapper>) {
+			return std::string_view(input.get());
+		} else {
+			return std::string_view(input);
+		}
+	}
+
+	/**
+	 * @brief Parse the whole given @p input as number of type @p TNumber, using @c std::from_chars.
+	 * @return The parsed number, or an error code: @c std::errc::invalid_argument if @p input is not a
+	 * number (or has trailing characters), @c std::errc::result_out_of_range if the number does not fit.
+	 */
+	template<typename TNumber>
+	requires std::is_arithmetic_v<TNumber>
+	inline std::errc parseNumber(std::string_view input, TNumber& result) {
+		const char* end = input.data() + input.size();
+		auto [ptr, ec] = std::from_chars(input.data(), end, result);
+		if(ec != std::errc()) { return ec; }
+		if(ptr != end) { return std::errc::invalid_argument; }
+		return std::errc();
+	}
+
+	/**
+	 * @brief Throw the exception matching the given error code from parseNumber().
+	 */
+	[[noreturn]] inline void throwParseError(std::errc ec, std::string_view input) {
+		if(ec == std::errc::result_out_of_range) {
+			throw std::out_of_range("Number out of range: " + std::string(input));
+		}
+		throw std::invalid_argument("Not a number: " + std::string(input));
+	}
+
+	/** @private */
+	constexpr uint64_t SWAR_ZEROS = 0x3030303030303030ull;
+
+	/**
+	 * @brief Parse 8 ascii digits at once, using SWAR (SIMD within a register).
+	 * @param digits Eight bytes in little-endian order, most significant digit first.
+	 * @param result Receives the parsed value.
+	 * @return @c false if any of the bytes is not a decimal digit.
+	 */
+	constexpr bool parseEightDigitsSWAR(uint64_t digits, uint64_t& result) {
+		// every byte must be within ['0', '9']: neither subtracting '0' nor adding (0x80 - ':') may set the top bit
+		if((((digits + 0x4646464646464646ull) | (digits - SWAR_ZEROS)) & 0x8080808080808080ull) != 0) {
+			return false;
+		}
+		digits -= SWAR_ZEROS;
+		// combine neighboring digits to 2-digit, then 4-digit and finally to one 8-digit value
+		digits = (digits * 10) + (digits >> 8);
+		digits = (((digits & 0x000000FF000000FFull) * 0x000F424000000064ull) + (((digits >> 16) & 0x000000FF000000FFull) * 0x0000271000000001ull)) >> 32;
+		result = digits;
+		return true;
+	}
+
+	/**
+	 * @brief Parse the given @p input, consisting of exactly @p DIGITS decimal digits, using SWAR (8 digits per step).
+	 * @details This falls back to a scalar loop on big-endian targets.
+	 * @return The parsed number, or @c std::nullopt if @p input has a different length or contains non-digits.
+	 */
+	template<std::integral TNumber, size_t DIGITS>
+	requires (DIGITS > 0 && DIGITS <= 19)
+	inline std::optional<TNumber> parseFixedWidth(std::string_view input) {
+		if(input.size() != DIGITS) [[unlikely]] { return {}; }
+		uint64_t result = 0;
+		if constexpr(std::endian::native == std::endian::little) {
+			constexpr size_t HEAD_DIGITS = DIGITS % 8;
+			size_t pos = 0;
+			if constexpr(HEAD_DIGITS != 0) {
+				// left-pad the leading digits with zeros, to form a full block of 8
+				uint64_t block = SWAR_ZEROS;
+				std::memcpy(reinterpret_cast<char*>(&block) + (8 - HEAD_DIGITS), input.data(), HEAD_DIGITS);
+				if(!parseEightDigitsSWAR(block, result)) { return {}; }
+				pos = HEAD_DIGITS;
+			}
+			for(; pos < DIGITS; pos += 8) {
+				uint64_t block;
+				std::memcpy(&block, input.data() + pos, 8);
+				uint64_t blockValue;
+				if(!parseEightDigitsSWAR(block, blockValue)) { return {}; }
+				result = result * 100000000ull + blockValue;
+			}
+		} else {
+			for(char c : input) {
+				if(c < '0' || c > '9') { return {}; }
+				result = result * 10 + static_cast<uint64_t>(c - '0');
+			}
+		}
+		if(result > static_cast<uint64_t>(std::numeric_limits<TNumber>::max())) { return {}; }
+		return static_cast<TNumber>(result);
+	}
+
+}
@@ -3,6 +3,8 @@
 #include <version>
 #include <vector>
 #include <cmath>
+#include <sstream>
+#include <string>
 
 #ifdef CXXITER_HAS_CXX20RANGES
 #include <ranges>
@@ -40,10 +42,23 @@ static std::vector<double> makeInput2(size_t cnt) {
 
 #define MAP_FN std::sqrt
 
+// every quoteEvery-th row has a quoted field, all others only take the unquoted (memchr) path
+static std::string makeInputCsv(size_t cnt, size_t quoteEvery) {
+	return CXXIter::range<size_t>(0, cnt)
+			.map([quoteEvery](size_t item) {
+				const std::string group = "group " + std::to_string(item % 7);
+				return "item" + std::to_string(item) + "," + ((item % quoteEvery == 0) ? ("\"" + group + "\"") : group) + "," + std::to_string(item % 1000) + ",x\n";
+			})
+			.fold(std::string(), [](std::string& result, const std::string& line) { result += line; });
+}
+
 static const std::vector<std::string> INPUT1 = makeInput1(1024 * 1024 * 100);
 static const std::vector<std::string> INPUT1_BURST = makeInput1(10);
 static const std::vector<double> INPUT2 = makeInput2(1024 * 1024 * 200);
 static const std::vector<double> INPUT2_BURST = makeInput2(10);
+static const std::string INPUT_CSV = makeInputCsv(1024 * 1024 * 10, 64);
+static const std::string INPUT_CSV_BURST = makeInputCsv(10, 64);
+static const std::string INPUT_CSV_QUOTED = makeInputCsv(1024 * 1024 * 10, 1);
 
 // ################################################################################################
 // BENCHMARKS
@@ -341,4 +356,37 @@ BENCHMARK_CAPTURE(OverlappingChunkedExactMath_Native, Large, INPUT2)->MinTime(10
 BENCHMARK_CAPTURE(OverlappingChunkedExactMath_Native, Small, INPUT2_BURST)->MinTime(10);
 
 
+// CSV PARSING
+// ==========
+static void CsvColumnSum_Native(benchmark::State& state, const std::string& input) {
+	for (auto _ : state) {
+		std::istringstream stream(input);
+		std::string line;
+		size_t sum = 0;
+		while(std::getline(stream, line)) {
+			std::istringstream lineStream(line);
+			std::string field;
+			for(size_t i = 0; i < 3; ++i) { std::getline(lineStream, field, ','); }
+			sum += std::stoul(field);
+		}
+		benchmark::DoNotOptimize(sum);
+	}
+}
+BENCHMARK_CAPTURE(CsvColumnSum_Native, Large, INPUT_CSV)->MinTime(10);
+BENCHMARK_CAPTURE(CsvColumnSum_Native, Small, INPUT_CSV_BURST)->MinTime(10);
+BENCHMARK_CAPTURE(CsvColumnSum_Native, LargeQuoted, INPUT_CSV_QUOTED)->MinTime(10);
+
+static void CsvColumnSum_CXXIter(benchmark::State& state, const std::string& input) {
+	for (auto _ : state) {
+		size_t sum = CXXIter::fromCsvColumns(input, {2})
+				.map([](const CXXIter::CsvRecord& record) { return std::stoul(std::string(record[0])); })
+				.sum();
+		benchmark::DoNotOptimize(sum);
+	}
+}
+BENCHMARK_CAPTURE(CsvColumnSum_CXXIter, Large, INPUT_CSV)->MinTime(10);
+BENCHMARK_CAPTURE(CsvColumnSum_CXXIter, Small, INPUT_CSV_BURST)->MinTime(10);
+BENCHMARK_CAPTURE(CsvColumnSum_CXXIter, LargeQuoted, INPUT_CSV_QUOTED)->MinTime(10);
+
+
 BENCHMARK_MAIN();
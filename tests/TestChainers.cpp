@@ -1,14 +1,17 @@
 #include <iostream>
+#include <algorithm>
 #include <vector>
 #include <functional>
 #include <string>
 #include <optional>
+#include <memory>
 #include <set>
 #include <map>
 #include <list>
 #include <deque>
 #include <unordered_set>
 #include <unordered_map>
+#include <thread>
 
 #include "TestCommon.h"
 
@@ -62,6 +65,263 @@ TEST(CXXIter, copied) {
 	}
 }
 
+TEST(CXXIter, buffered) {
+	{ // order is preserved, also when the buffer is much smaller than the input
+		std::vector<size_t> output = CXXIter::range<size_t>(0, 9999)
+				.map([](size_t item) { return item * 2; })
+				.buffered(4)
+				.collect<std::vector>();
+		ASSERT_EQ(output.size(), 10000);
+		for(size_t i = 0; i < output.size(); ++i) { ASSERT_EQ(output[i], i * 2); }
+	}
+	{ // sizeHint
+		auto iter = CXXIter::range<size_t>(0, 9).buffered(2);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 10);
+		ASSERT_EQ(iter.next().value(), 0);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 9);
+		ASSERT_EQ(iter.sizeHint().upperBound.value(), 9);
+	}
+	{ // references are copied by the worker, move-only items are moved
+		std::vector<std::string> input = {"a", "b", "c"};
+		std::vector<std::string> output = CXXIter::from(input)
+				.buffered(1)
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("a", "b", "c"));
+		ASSERT_THAT(input, ElementsAre("a", "b", "c"));
+		std::string csv;
+		for(size_t i = 0; i < 1000; ++i) { csv += std::to_string(i) + ",x\n"; }
+		std::vector<std::string> fields = CXXIter::fromCsv(csv)
+				.buffered(64)
+				.map([](const CXXIter::CsvRecord& record) { return std::string(record[0]); })
+				.collect<std::vector>();
+		ASSERT_EQ(fields.size(), 1000);
+		for(size_t i = 0; i < fields.size(); ++i) { ASSERT_EQ(fields[i], std::to_string(i)); }
+		std::vector<std::unique_ptr<int>> owned = CXXIter::range(0, 2)
+				.map([](int item) { return std::make_unique<int>(item); })
+				.buffered(8)
+				.collect<std::vector>();
+		ASSERT_EQ(owned.size(), 3);
+		ASSERT_EQ(*owned[2], 2);
+	}
+	{ // stopping early joins the worker, even though the input is infinite
+		size_t output = CXXIter::fromFn([]() -> std::optional<size_t> { return 1; })
+				.buffered(16)
+				.take(100)
+				.sum();
+		ASSERT_EQ(output, 100);
+	}
+	{ // exceptions are rethrown after the elements produced before
+		auto iter = CXXIter::range(0, 5)
+				.map([](int item) {
+					if(item == 2) { throw std::runtime_error("failed"); }
+					return item;
+				})
+				.buffered(8);
+		ASSERT_EQ(iter.next().value(), 0);
+		ASSERT_EQ(iter.next().value(), 1);
+		ASSERT_THROW(iter.next(), std::runtime_error);
+		ASSERT_FALSE(iter.next().has_value());
+	}
+}
+
+TEST(CXXIter, parMap) {
+	{ // order is preserved
+		std::vector<std::string> output = CXXIter::range<size_t>(0, 9999)
+				.parMap([](size_t item) { return std::to_string(item * 2); }, 4, 16)
+				.collect<std::vector>();
+		ASSERT_EQ(output.size(), 10000);
+		for(size_t i = 0; i < output.size(); ++i) { ASSERT_EQ(output[i], std::to_string(i * 2)); }
+	}
+	{ // works on generators, and with batches larger than the input
+		auto iter = CXXIter::generate([]() -> CXXIter::Generator<int> {
+			for(int i = 0; i < 5; ++i) { co_yield i; }
+		}).parMap([](int item) { return item * item; }, 2, 100);
+		ASSERT_EQ(iter.next().value(), 0);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 0);
+		ASSERT_THAT(iter.collect<std::vector>(), ElementsAre(1, 4, 9, 16));
+	}
+	{ // sizeHint and references
+		std::vector<std::string> input = {"a", "bb", "ccc"};
+		auto iter = CXXIter::from(input).parMap([](const std::string& item) { return item.size(); }, 2, 1);
+		ASSERT_EQ(iter.size(), 3);
+		ASSERT_EQ(iter.next().value(), 1);
+		ASSERT_EQ(iter.size(), 2);
+		ASSERT_THAT(iter.collect<std::vector>(), ElementsAre(2, 3));
+	}
+	{ // elements passed by reference into reused storage are copied before the input advances
+		std::string input;
+		for(size_t i = 0; i < 1000; ++i) { input += std::to_string(i) + ",x\n"; }
+		std::vector<std::string> output = CXXIter::fromCsv(input)
+				.parMap([](const CXXIter::CsvRecord& record) { return std::string(record[0]); }, 4, 64)
+				.collect<std::vector>();
+		ASSERT_EQ(output.size(), 1000);
+		for(size_t i = 0; i < output.size(); ++i) { ASSERT_EQ(output[i], std::to_string(i)); }
+	}
+	{ // unordered
+		std::vector<size_t> output = CXXIter::range<size_t>(0, 9999)
+				.parMapUnordered([](size_t item) { return item * 2; }, 4, 16)
+				.collect<std::vector>();
+		std::sort(output.begin(), output.end());
+		ASSERT_EQ(output.size(), 10000);
+		for(size_t i = 0; i < output.size(); ++i) { ASSERT_EQ(output[i], i * 2); }
+	}
+	{ // exceptions are rethrown after the elements before the failed one
+		auto iter = CXXIter::range(0, 99)
+				.parMap([](int item) {
+					if(item == 10) { throw std::runtime_error("failed"); }
+					return item;
+				}, 3, 4);
+		for(int i = 0; i < 10; ++i) { ASSERT_EQ(iter.next().value(), i); }
+		ASSERT_THROW(iter.next(), std::runtime_error);
+		ASSERT_FALSE(iter.next().has_value());
+		ASSERT_EQ(iter.sizeHint().upperBound.value(), 0);
+	}
+	{ // stopping early
+		size_t output = CXXIter::fromFn([]() -> std::optional<size_t> { return 1; })
+				.parMap([](size_t item) { return item; }, 2, 8)
+				.take(100)
+				.sum();
+		ASSERT_EQ(output, 100);
+	}
+}
+
+TEST(CXXIter, tee) {
+	{ // interleaved, with every element produced only once
+		size_t producedCnt = 0;
+		auto [a, b, c] = CXXIter::range(0, 9)
+				.map([&producedCnt](int item) { ++producedCnt; return std::to_string(item); })
+				.tee<3>(16);
+		ASSERT_EQ(a.sizeHint().lowerBound, 10);
+		ASSERT_EQ(a.next().value(), "0");
+		ASSERT_EQ(a.sizeHint().lowerBound, 9);
+		ASSERT_EQ(b.next().value(), "0");
+		ASSERT_EQ(c.next().value(), "0");
+		ASSERT_EQ(a.next().value(), "1");
+		ASSERT_EQ(producedCnt, 2);
+		std::vector<std::string> outputB;
+		std::vector<std::string> outputC;
+		while(true) {
+			auto itemB = b.next();
+			auto itemC = c.next();
+			if(!itemB.has_value()) { break; }
+			outputB.push_back(itemB.value());
+			outputC.push_back(itemC.value());
+		}
+		ASSERT_EQ(producedCnt, 10);
+		ASSERT_THAT(outputB, ElementsAre("1", "2", "3", "4", "5", "6", "7", "8", "9"));
+		ASSERT_EQ(outputB, outputC);
+		ASSERT_THAT(a.collect<std::vector>(), ElementsAre("2", "3", "4", "5", "6", "7", "8", "9"));
+		ASSERT_EQ(producedCnt, 10);
+	}
+	{ // dropped branches no longer hold back the others
+		auto branches = CXXIter::range(0, 99).tee<2>(1);
+		{ auto dropped = std::move(branches[1]); }
+		ASSERT_EQ(branches[0].sum(), 4950);
+	}
+	{ // move-only last consumer, from references
+		std::vector<std::string> input = {"1337", "42"};
+		auto [a, b] = CXXIter::from(input).tee<2>();
+		ASSERT_THAT(a.collect<std::vector>(), ElementsAre("1337", "42"));
+		ASSERT_THAT(b.collect<std::vector>(), ElementsAre("1337", "42"));
+		ASSERT_THAT(input, ElementsAre("1337", "42"));
+	}
+	{ // branches consumed on different threads
+		auto [a, b] = CXXIter::range<size_t>(1, 10000).tee<2>(16);
+		size_t sum = 0;
+		std::thread sumThread([&sum, &a]() { sum = a.sum(); });
+		size_t evenCnt = b.filter([](size_t item) { return item % 2 == 0; }).count();
+		sumThread.join();
+		ASSERT_EQ(sum, 50005000);
+		ASSERT_EQ(evenCnt, 5000);
+	}
+	{ // exceptions are rethrown to every branch, which then ends
+		size_t producedCnt = 0;
+		auto [a, b] = CXXIter::range(0, 9)
+				.map([&producedCnt](int item) {
+					++producedCnt;
+					if(item == 3) { throw std::runtime_error("failed"); }
+					return item;
+				})
+				.tee<2>(16);
+		ASSERT_EQ(a.next().value(), 0);
+		ASSERT_EQ(a.next().value(), 1);
+		ASSERT_EQ(a.next().value(), 2);
+		ASSERT_THROW(a.next(), std::runtime_error);
+		ASSERT_FALSE(a.next().has_value());
+		ASSERT_EQ(b.next().value(), 0);
+		ASSERT_EQ(b.next().value(), 1);
+		ASSERT_EQ(b.next().value(), 2);
+		ASSERT_THROW(b.next(), std::runtime_error);
+		ASSERT_FALSE(b.next().has_value());
+		ASSERT_EQ(producedCnt, 4);
+	}
+	{ // branches blocked on a full buffer are woken up by the exception
+		auto [a, b] = CXXIter::range(0, 999)
+				.map([](int item) {
+					if(item == 500) { throw std::runtime_error("failed"); }
+					return item;
+				})
+				.tee<2>(2);
+		size_t cntA = 0;
+		bool failedA = false;
+		std::thread threadA([&]() {
+			try {
+				a.forEach([&cntA](int) { ++cntA; });
+			} catch(const std::runtime_error&) { failedA = true; }
+		});
+		size_t cntB = 0;
+		ASSERT_THROW(b.forEach([&cntB](int) { ++cntB; }), std::runtime_error);
+		threadA.join();
+		ASSERT_TRUE(failedA);
+		ASSERT_EQ(cntA, 500);
+		ASSERT_EQ(cntB, 500);
+	}
+}
+
+TEST(CXXIter, cached) {
+	{ // lazy: stopping early only computes the consumed prefix
+		size_t producedCnt = 0;
+		auto cache = CXXIter::range(0, 9)
+				.map([&producedCnt](int item) { ++producedCnt; return std::to_string(item); })
+				.cached();
+		ASSERT_EQ(cache.iter().sizeHint().lowerBound, 10);
+		ASSERT_THAT(cache.iter().take(3).collect<std::vector>(), ElementsAre("0", "1", "2"));
+		ASSERT_EQ(producedCnt, 3);
+		ASSERT_EQ(cache.recordedCnt(), 3);
+		ASSERT_FALSE(cache.isComplete());
+		auto iter = cache.iter();
+		ASSERT_EQ(iter.next().value(), "0");
+		ASSERT_EQ(iter.size(), 9);
+		ASSERT_EQ(producedCnt, 3);
+		// moving an iterator moves its position
+		auto movedIter = std::move(iter);
+		ASSERT_EQ(movedIter.next().value(), "1");
+		ASSERT_EQ(movedIter.size(), 8);
+		// replaying records the remaining elements
+		auto replay = cache.replay();
+		ASSERT_EQ(producedCnt, 10);
+		ASSERT_TRUE(cache.isComplete());
+		ASSERT_EQ(replay.size(), 10);
+		ASSERT_EQ(replay.nextBack().value(), "9");
+		ASSERT_EQ(replay.next().value(), "0");
+		ASSERT_EQ(replay.size(), 8);
+		ASSERT_THAT(replay.collect<std::vector>(), ElementsAre("1", "2", "3", "4", "5", "6", "7", "8"));
+		ASSERT_THAT(cache.replay().reverse().take(2).collect<std::vector>(), ElementsAre("9", "8"));
+		ASSERT_EQ(movedIter.count(), 8);
+		ASSERT_EQ(cache.iter().count(), 10);
+		ASSERT_EQ(producedCnt, 10);
+	}
+	{ // replays are contiguous and pass references to the recording
+		auto cache = CXXIter::range(1, 100).cached();
+		std::vector<const int*> ptrs = cache.replay().map([](const int& item) { return &item; }).collect<std::vector>();
+		ASSERT_EQ(ptrs.size(), 100);
+		for(size_t i = 0; i < ptrs.size(); ++i) { ASSERT_EQ(ptrs[i], ptrs[0] + i); }
+		ASSERT_EQ(&cache.replay().next().value(), ptrs[0]);
+		ASSERT_EQ(cache.replay().sum(), 5050);
+		ASSERT_EQ(cache.replay().skip(98).sum(), 199);
+	}
+}
+
 TEST(CXXIter, indexed) {
 	{
 		std::vector<std::string> input = {"1337", "42", "64"};
@@ -220,6 +480,12 @@ TEST(CXXIter, reverse) {
 		ASSERT_THAT(output, ElementsAre(Pair(5, "5"), Pair(4, "4"), Pair(3, "3"), Pair(2, "2"), Pair(1, "1")));
 	}
 
+	{ // Reverse references (DoubleEndedIterator and internal Cache)
+		std::vector<size_t> input = {1, 42, 2};
+		ASSERT_THAT(CXXIter::from(input).reverse().collect<std::vector>(), ElementsAre(2, 42, 1));
+		ASSERT_THAT(CXXIter::from(input).filter([](size_t) { return true; }).reverse().collect<std::vector>(), ElementsAre(2, 42, 1));
+	}
+
 	{ // Double Reverse using DoubleEndedIterator
 		std::vector<size_t> input = {1, 42, 2, 1337, 3, 4, 69, 5, 6, 5};
 		std::vector<size_t> output = CXXIter::from(input).copied()
@@ -1817,3 +2083,105 @@ TEST(CXXIter, sortBy) {
 		ASSERT_THAT(output, ElementsAre("500", "55", "1337", "10000"));
 	}
 }
+
+TEST(CXXIter, sortByCached) {
+	{ // sizeHint
+		std::vector<std::string> input = {"test1", "test2", "test23", "test", "tes"};
+		SizeHint sizeHint = CXXIter::from(input)
+				.sortByCached([](const std::string& item) { return item.size(); })
+				.sizeHint();
+		ASSERT_EQ(sizeHint.lowerBound, input.size());
+		ASSERT_EQ(sizeHint.upperBound.value(), input.size());
+	}
+	{ // ASCENDING (stable)
+		std::vector<std::string> input = {"test1", "test2", "test23", "test", "tes"};
+		std::vector<std::string> output = CXXIter::from(input)
+			.sortByCached<CXXIter::ASCENDING>([](const std::string& item) { return item.size(); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("tes", "test", "test1", "test2", "test23"));
+	}
+	{ // DESCENDING (stable)
+		std::vector<std::string> input = {"test1", "test2", "test23", "test", "tes"};
+		std::vector<std::string> output = CXXIter::from(input)
+			.sortByCached<CXXIter::DESCENDING>([](const std::string& item) { return item.size(); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("test23", "test1", "test2", "test", "tes"));
+	}
+	{ // sort value is extracted exactly once per item
+		size_t extractCnt = 0;
+		std::vector<std::string> input = {"1337", "55", "500", "10000", "7", "42"};
+		std::vector<std::string> output = CXXIter::from(input)
+			.sortByCached([&extractCnt](const std::string& item) { extractCnt += 1; return std::stoi(item); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("7", "42", "55", "500", "1337", "10000"));
+		ASSERT_EQ(extractCnt, input.size());
+	}
+	{ // double-ended & move-only items
+		std::vector<std::unique_ptr<int>> input;
+		input.push_back(std::make_unique<int>(3));
+		input.push_back(std::make_unique<int>(1));
+		input.push_back(std::make_unique<int>(2));
+		auto iter = CXXIter::SrcMov(std::move(input))
+			.sortByCached([](const std::unique_ptr<int>& item) { return *item; });
+		ASSERT_EQ(iter.size(), 3);
+		ASSERT_EQ(*iter.nextBack().value(), 3);
+		ASSERT_EQ(iter.size(), 2);
+		ASSERT_EQ(*iter.next().value(), 1);
+		ASSERT_EQ(iter.size(), 1);
+		ASSERT_EQ(iter.sizeHint().upperBound.value(), 1);
+		ASSERT_EQ(*iter.next().value(), 2);
+		ASSERT_EQ(iter.size(), 0);
+		ASSERT_FALSE(iter.next().has_value());
+	}
+}
+
+TEST(CXXIter, sortIndirect) {
+	{ // sizeHint & size
+		std::vector<std::string> input = {"test1", "test2", "test23", "test", "tes"};
+		auto iter = CXXIter::from(input).sortIndirect();
+		SizeHint sizeHint = iter.sizeHint();
+		ASSERT_EQ(sizeHint.lowerBound, input.size());
+		ASSERT_EQ(sizeHint.upperBound.value(), input.size());
+		ASSERT_EQ(iter.size(), input.size());
+		iter.next();
+		ASSERT_EQ(iter.size(), input.size() - 1);
+		ASSERT_EQ(iter.sizeHint().upperBound.value(), input.size() - 1);
+	}
+	{ // yields references into the source
+		std::vector<std::string> input = {"c", "a", "b"};
+		std::vector<std::string*> output = CXXIter::from(input)
+			.sortIndirect()
+			.map([](std::string& item) { return &item; })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(&input[1], &input[2], &input[0]));
+	}
+	{ // custom comparer, stable, both directions
+		std::vector<std::string> input = {"test1", "test2", "test23", "test", "tes"};
+		std::vector<std::string> output = CXXIter::from(input)
+			.sortIndirect<true>([](const std::string& a, const std::string& b) { return (a.size() < b.size()); })
+			.copied()
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("tes", "test", "test1", "test2", "test23"));
+
+		auto iter = CXXIter::from(input).sortIndirect<CXXIter::DESCENDING>();
+		ASSERT_EQ(iter.nextBack().value(), "tes");
+		ASSERT_EQ(iter.next().value(), "test23");
+		iter.advanceBy(2);
+		ASSERT_EQ(iter.next().value(), "test");
+		ASSERT_FALSE(iter.next().has_value());
+		ASSERT_FALSE(iter.nextBack().has_value());
+	}
+	{ // items are never copied or moved
+		LifecycleEvents evtLog;
+		std::vector<LifecycleDebugger> input;
+		input.reserve(5);
+		for(const char* str : {"e", "b", "d", "a", "c"}) { input.emplace_back(str, evtLog); }
+		evtLog.clear();
+		std::vector<std::string> output = CXXIter::from(input)
+			.sortIndirect<false>([](const LifecycleDebugger& a, const LifecycleDebugger& b) { return (a.heapTest < b.heapTest); })
+			.map([](const LifecycleDebugger& item) { return item.heapTest; })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("a", "b", "c", "d", "e"));
+		ASSERT_EQ(evtLog.size(), 0);
+	}
+}
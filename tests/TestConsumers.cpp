@@ -9,6 +9,7 @@
 #include <deque>
 #include <unordered_set>
 #include <unordered_map>
+#include <chrono>
 
 #include "TestCommon.h"
 
@@ -42,6 +43,44 @@ TEST(CXXIter, forEach) {
 	ASSERT_THAT(output, ElementsAre("1337", "42", "64"));
 }
 
+TEST(CXXIter, forEachSegmented) {
+	{ // deque: block layout is implementation-defined, so it is iterated element-wise
+		std::deque<size_t> input = CXXIter::range<size_t>(0, 9999).collect<std::deque>();
+		static_assert(!CXXIter::CXXIterSegmentedIterator<decltype(CXXIter::from(input))>);
+		auto iter = CXXIter::from(input);
+		iter.advanceBy(10);
+		ASSERT_EQ(std::move(iter).sum(), 49995000 - 45);
+		std::vector<size_t> output = CXXIter::from(input).collect<std::vector>();
+		ASSERT_TRUE(std::equal(input.begin(), input.end(), output.begin(), output.end()));
+	}
+	{ // chain of vectors
+		std::vector<int> input1 = {1, 2, 3};
+		std::vector<int> input2 = {};
+		std::vector<int> input3 = {4, 5};
+		auto iter = CXXIter::from(input1).chain(CXXIter::from(input2)).chain(CXXIter::from(input3));
+		static_assert(CXXIter::CXXIterSegmentedIterator<decltype(iter)>);
+		ASSERT_EQ(iter.next().value(), 1);
+		std::vector<int> output;
+		std::move(iter).forEach([&output](int& item) { output.push_back(item); });
+		ASSERT_THAT(output, ElementsAre(2, 3, 4, 5));
+	}
+	{ // flatMap over vectors of move-only items
+		std::vector<std::vector<std::string>> input = {{"a", "b"}, {}, {"c"}};
+		auto iter = CXXIter::from(input)
+				.flatMap([](std::vector<std::string>& item) { return std::move(item); });
+		static_assert(CXXIter::CXXIterSegmentedIterator<decltype(iter)>);
+		std::vector<std::string> output = std::move(iter).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("a", "b", "c"));
+		ASSERT_TRUE(input[0].empty());
+	}
+	{ // no segments for node-based containers, or after non-contiguous chainers
+		std::list<int> input = {1, 2, 3};
+		static_assert(!CXXIter::CXXIterSegmentedIterator<decltype(CXXIter::from(input))>);
+		std::vector<int> vecInput = {1, 2, 3};
+		static_assert(!CXXIter::CXXIterSegmentedIterator<decltype(CXXIter::from(vecInput).filter([](int) { return true; }))>);
+	}
+}
+
 TEST(CXXIter, fold) {
 	std::vector<double> input = {1.331335363800390, 1.331335363800390, 1.331335363800390, 1.331335363800390};
 	double output = CXXIter::from(input)
@@ -51,6 +90,64 @@ TEST(CXXIter, fold) {
 	ASSERT_NEAR(output, 3.141592653589793, 0.0000000005);
 }
 
+TEST(CXXIter, resumableConsumers) {
+	{ // forEach
+		std::vector<int> output;
+		auto consumer = CXXIter::range(0, 9).resumableForEach([&output](int item) { output.push_back(item); });
+		ASSERT_TRUE(output.empty());
+		ASSERT_FALSE(consumer.step(4));
+		ASSERT_THAT(output, ElementsAre(0, 1, 2, 3));
+		ASSERT_FALSE(consumer.step(6));
+		ASSERT_FALSE(consumer.done()); // consumed exactly the last elements, the end is noticed by the next step
+		ASSERT_TRUE(consumer.step(1));
+		ASSERT_EQ(output.size(), 10);
+		ASSERT_TRUE(consumer.done());
+		ASSERT_TRUE(consumer.step(1));
+		ASSERT_EQ(output.size(), 10);
+	}
+	{ // fold
+		auto consumer = CXXIter::range(1, 100).resumableFold(0, [](int& sum, int item) { sum += item; });
+		consumer.step(10);
+		ASSERT_EQ(consumer.result(), 55);
+		while(!consumer.stepFor(std::chrono::microseconds(10), 8)) {}
+		ASSERT_EQ(consumer.result(), 5050);
+	}
+	{ // collect
+		std::vector<std::string> input = {"a", "b", "c"};
+		auto consumer = CXXIter::from(input).resumableCollect<std::set>();
+		consumer.step(2);
+		ASSERT_THAT(consumer.result(), ElementsAre("a", "b"));
+		consumer.step(2);
+		ASSERT_THAT(consumer.result(), ElementsAre("a", "b", "c"));
+		ASSERT_EQ(input.size(), 3);
+	}
+	{ // round-robin scheduling
+		std::vector<std::string> log;
+		auto small = CXXIter::range(0, 2).resumableForEach([&log](int item) { log.push_back("s" + std::to_string(item)); });
+		auto large = CXXIter::range(0, 5).resumableForEach([&log](int item) { log.push_back("l" + std::to_string(item)); });
+		CXXIter::RoundRobinScheduler scheduler(2);
+		scheduler.add(large);
+		scheduler.add(small);
+		ASSERT_EQ(scheduler.pending(), 2);
+		ASSERT_TRUE(scheduler.runTurn());
+		ASSERT_THAT(log, ElementsAre("l0", "l1"));
+		scheduler.run();
+		ASSERT_EQ(scheduler.pending(), 0);
+		ASSERT_THAT(log, ElementsAre("l0", "l1", "s0", "s1", "l2", "l3", "s2", "l4", "l5"));
+	}
+	{ // time-budgeted scheduling (ranges are inclusive)
+		auto small = CXXIter::range(0, 10).resumableFold(0, [](int& acc, int item) { acc += item; });
+		auto large = CXXIter::range(0, 100000).resumableFold(0, [](int& acc, int item) { acc ^= item; });
+		CXXIter::RoundRobinScheduler scheduler(128);
+		scheduler.add(small);
+		scheduler.add(large);
+		while(scheduler.runFor(std::chrono::microseconds(100))) {}
+		ASSERT_TRUE(small.done());
+		ASSERT_TRUE(large.done());
+		ASSERT_EQ(small.result(), 55);
+	}
+}
+
 TEST(CXXIter, all) {
 	auto boolTester = [](const std::vector<bool>& input) -> bool {
 		return CXXIter::from(input).copied().all();
@@ -735,3 +832,260 @@ TEST(CXXIter, collectInto) {
 	#undef COLLECTOR_TEST_FOR_CONTAINER
 	#undef PAIR_COLLECTOR_TEST_FOR_CONTAINER
 }
+
+TEST(CXXIter, unzipInto) {
+	{ // pairs
+		std::vector<std::pair<std::string, int>> input = {{"1337", 1337}, {"42", 42}, {"64", 64}};
+		std::vector<std::string> outputKeys;
+		std::vector<int> outputValues = {-1};
+		CXXIter::from(input).unzipInto(outputKeys, outputValues);
+		ASSERT_THAT(outputKeys, ElementsAre("1337", "42", "64"));
+		ASSERT_THAT(outputValues, ElementsAre(-1, 1337, 42, 64));
+	}
+	{ // tuples into mixed container types
+		std::vector<std::tuple<int, std::string, float>> input = {{1, "a", 1.0f}, {2, "b", 2.0f}, {1, "c", 3.0f}};
+		std::set<int> output1;
+		std::vector<std::string> output2;
+		std::list<float> output3;
+		CXXIter::from(std::move(input)).unzipInto(output1, output2, output3);
+		ASSERT_THAT(output1, ElementsAre(1, 2));
+		ASSERT_THAT(output2, ElementsAre("a", "b", "c"));
+		ASSERT_THAT(output3, ElementsAre(1.0f, 2.0f, 3.0f));
+	}
+	{ // non-replayable source
+		size_t generatorState = 0;
+		std::vector<size_t> outputIdx;
+		std::vector<size_t> outputSquares;
+		CXXIter::fromFn([&generatorState]() -> std::optional<size_t> {
+					if(generatorState == 4) { return {}; }
+					return generatorState++;
+				})
+				.map([](size_t item) { return std::make_pair(item, item * item); })
+				.unzipInto(outputIdx, outputSquares);
+		ASSERT_THAT(outputIdx, ElementsAre(0, 1, 2, 3));
+		ASSERT_THAT(outputSquares, ElementsAre(0, 1, 4, 9));
+	}
+	{ // empty
+		std::vector<std::pair<int, int>> input = {};
+		std::vector<int> output1, output2;
+		CXXIter::from(input).unzipInto(output1, output2);
+		ASSERT_EQ(output1.size(), 0);
+		ASSERT_EQ(output2.size(), 0);
+	}
+}
+
+TEST(CXXIter, partition) {
+	{ // references
+		std::vector<int> input = {1, 2, 3, 4, 5, 6, 7};
+		auto [even, odd] = CXXIter::from(input)
+				.partition([](int item) { return (item % 2) == 0; });
+		ASSERT_THAT(even, ElementsAre(2, 4, 6));
+		ASSERT_THAT(odd, ElementsAre(1, 3, 5, 7));
+	}
+	{ // move
+		std::vector<std::string> input = {"1337", "42", "64", "31337"};
+		std::pair<std::vector<std::string>, std::vector<std::string>> output = CXXIter::from(std::move(input))
+				.partition([](const std::string& item) { return item.size() > 2; });
+		ASSERT_THAT(output.first, ElementsAre("1337", "31337"));
+		ASSERT_THAT(output.second, ElementsAre("42", "64"));
+	}
+	{ // custom target container
+		std::vector<int> input = {3, 1, 2, 3, 5, 4};
+		std::pair<std::set<int>, std::set<int>> output = CXXIter::from(input)
+				.partition<std::set>([](int item) { return item >= 3; });
+		ASSERT_THAT(output.first, ElementsAre(3, 4, 5));
+		ASSERT_THAT(output.second, ElementsAre(1, 2));
+	}
+	{ // empty
+		std::vector<int> input = {};
+		auto [matching, rest] = CXXIter::from(input)
+				.partition([](int item) { return (item % 2) == 0; });
+		ASSERT_EQ(matching.size(), 0);
+		ASSERT_EQ(rest.size(), 0);
+	}
+}
+
+TEST(CXXIter, partitionBy) {
+	{
+		std::vector<int> input = {1, 2, 3, 4, 5, 6, 7};
+		std::vector<std::vector<int>> output = CXXIter::from(input)
+				.partitionBy([](int item) -> size_t { return (item % 3); }, 3);
+		ASSERT_EQ(output.size(), 3);
+		ASSERT_THAT(output[0], ElementsAre(3, 6));
+		ASSERT_THAT(output[1], ElementsAre(1, 4, 7));
+		ASSERT_THAT(output[2], ElementsAre(2, 5));
+	}
+	{ // unused partitions stay empty
+		std::vector<std::string> input = {"a", "bb", "cc", "dddd"};
+		std::vector<std::list<std::string>> output = CXXIter::from(input)
+				.partitionBy<std::list>([](const std::string& item) { return item.size(); }, 5);
+		ASSERT_EQ(output.size(), 5);
+		ASSERT_EQ(output[0].size(), 0);
+		ASSERT_THAT(output[1], ElementsAre("a"));
+		ASSERT_THAT(output[2], ElementsAre("bb", "cc"));
+		ASSERT_EQ(output[3].size(), 0);
+		ASSERT_THAT(output[4], ElementsAre("dddd"));
+	}
+	{ // partition index out of range
+		std::vector<int> input = {1, 2, 3};
+		ASSERT_THROW(
+			CXXIter::from(input).partitionBy([](int item) -> size_t { return item; }, 3),
+			std::out_of_range
+		);
+	}
+}
+
+TEST(CXXIter, broadcast) {
+	std::vector<std::string> input = {"1337", "42", "64"};
+	std::vector<std::string> copies;
+	auto [copyFn, lengthFn] = CXXIter::from(input).broadcast(
+		[&copies](const std::string& item) { copies.push_back(item); },
+		[length = size_t(0)](const std::string& item) mutable { length += item.size(); return length; }
+	);
+	ASSERT_THAT(copies, ElementsAre("1337", "42", "64"));
+	ASSERT_THAT(input, ElementsAre("1337", "42", "64"));
+	ASSERT_EQ(lengthFn(""), 8);
+}
+
+TEST(CXXIter, aggregate) {
+	{ // basic
+		std::vector<int> input = {1, 3, 2, 5, 4};
+		auto [cnt, sum, max, min] = CXXIter::from(input)
+				.aggregate(CXXIter::agg::count(), CXXIter::agg::sum(), CXXIter::agg::max(), CXXIter::agg::min());
+		ASSERT_EQ(cnt, 5);
+		ASSERT_EQ(sum, 15);
+		ASSERT_TRUE(max.has_value());
+		ASSERT_EQ(max.value(), 5);
+		ASSERT_EQ(&max.value(), &input[3]);
+		ASSERT_TRUE(min.has_value());
+		ASSERT_EQ(min.value(), 1);
+	}
+	{ // after filter, owned items
+		std::vector<std::string> input = {"a", "bbb", "cc", "dddd", "e"};
+		auto [cnt, cntLong, longest, anyE, allShort, totalLen] = CXXIter::from(input)
+				.filter([](const std::string& item) { return item != "cc"; })
+				.copied()
+				.aggregate(
+					CXXIter::agg::count(),
+					CXXIter::agg::count([](const std::string& item) { return item.size() > 2; }),
+					CXXIter::agg::maxBy([](const std::string& item) { return item.size(); }),
+					CXXIter::agg::any([](const std::string& item) { return item == "e"; }),
+					CXXIter::agg::all([](const std::string& item) { return item.size() < 4; }),
+					CXXIter::agg::fold(size_t(0), [](size_t& res, const std::string& item) { res += item.size(); })
+				);
+		static_assert(std::is_same_v<decltype(longest), CXXIter::IterValue<std::string>>);
+		ASSERT_EQ(cnt, 4);
+		ASSERT_EQ(cntLong, 2);
+		ASSERT_EQ(longest.value(), "dddd");
+		ASSERT_TRUE(anyE);
+		ASSERT_FALSE(allShort);
+		ASSERT_EQ(totalLen, 9);
+	}
+	{ // mean & sum with explicit types
+		std::vector<int> input = {1, 2, 3, 4};
+		auto [mean, sampleMean, sum] = CXXIter::from(input)
+				.aggregate(
+					CXXIter::agg::mean<CXXIter::StatisticNormalization::N, float, float>(),
+					CXXIter::agg::mean<CXXIter::StatisticNormalization::N_MINUS_ONE, float, float>(),
+					CXXIter::agg::sum(100.0)
+				);
+		ASSERT_NEAR(mean.value(), 2.5f, 0.0001);
+		ASSERT_NEAR(sampleMean.value(), 10.0f / 3.0f, 0.0001);
+		ASSERT_NEAR(sum, 110.0, 0.0001);
+	}
+	{ // empty
+		std::vector<int> input = {};
+		auto [cnt, max, mean] = CXXIter::from(input)
+				.aggregate(CXXIter::agg::count(), CXXIter::agg::max(), CXXIter::agg::mean());
+		ASSERT_EQ(cnt, 0);
+		ASSERT_FALSE(max.has_value());
+		ASSERT_FALSE(mean.has_value());
+	}
+}
+
+TEST(CXXIter, sortInPlace) {
+	{ // default comparison
+		std::vector<float> input = {1.0f, 2.0f, 0.5f, 3.0f, -42.0f};
+		const float* dataPtr = input.data();
+		CXXIter::from(input).sortInPlace();
+		ASSERT_THAT(input, ElementsAre(-42.0f, 0.5f, 1.0f, 2.0f, 3.0f));
+		ASSERT_EQ(input.data(), dataPtr);
+		CXXIter::from(input).sortInPlace<CXXIter::DESCENDING, true>();
+		ASSERT_THAT(input, ElementsAre(3.0f, 2.0f, 1.0f, 0.5f, -42.0f));
+	}
+	{ // custom comparer, only the remaining range
+		std::vector<std::string> input = {"test1", "test23", "test", "tes", "t"};
+		auto iter = CXXIter::from(input);
+		ASSERT_EQ(iter.next().value(), "test1");
+		iter.sortInPlace<true>([](const std::string& a, const std::string& b) { return (a.size() < b.size()); });
+		ASSERT_THAT(input, ElementsAre("test1", "t", "tes", "test", "test23"));
+		ASSERT_FALSE(iter.next().has_value());
+	}
+}
+
+TEST(CXXIter, partitionInPlace) {
+	{ // stable
+		std::vector<int> input = {1, 2, 3, 4, 5, 6};
+		size_t evenCnt = CXXIter::from(input).partitionInPlace<true>([](int item) { return (item % 2 == 0); });
+		ASSERT_EQ(evenCnt, 3);
+		ASSERT_THAT(input, ElementsAre(2, 4, 6, 1, 3, 5));
+	}
+	{ // unstable
+		std::vector<int> input = {1, 2, 3, 4, 5, 6};
+		size_t evenCnt = CXXIter::from(input).partitionInPlace([](int item) { return (item % 2 == 0); });
+		ASSERT_EQ(evenCnt, 3);
+		ASSERT_TRUE(CXXIter::from(input).take(3).all([](int item) { return (item % 2 == 0); }));
+		ASSERT_TRUE(CXXIter::from(input).skip(3).all([](int item) { return (item % 2 != 0); }));
+	}
+}
+
+TEST(CXXIter, retain) {
+	{ // vector
+		std::vector<int> input = {1, 2, 3, 4, 5, 6};
+		const size_t capacity = input.capacity();
+		size_t removedCnt = CXXIter::from(input).retain([](int item) { return (item % 2 == 0); });
+		ASSERT_EQ(removedCnt, 3);
+		ASSERT_THAT(input, ElementsAre(2, 4, 6));
+		ASSERT_EQ(input.capacity(), capacity);
+	}
+	{ // only the remaining range
+		std::vector<int> input = {1, 2, 3, 4, 5, 6};
+		auto iter = CXXIter::from(input);
+		iter.next();
+		iter.nextBack();
+		size_t removedCnt = iter.retain([](int item) { return (item % 2 == 0); });
+		ASSERT_EQ(removedCnt, 2);
+		ASSERT_THAT(input, ElementsAre(1, 2, 4, 6));
+		ASSERT_FALSE(iter.next().has_value());
+	}
+	{ // list
+		std::list<std::string> input = {"a", "bb", "c", "dd"};
+		size_t removedCnt = CXXIter::from(input).retain([](const std::string& item) { return (item.size() > 1); });
+		ASSERT_EQ(removedCnt, 2);
+		ASSERT_THAT(input, ElementsAre("bb", "dd"));
+	}
+}
+
+TEST(CXXIter, removeInPlace) {
+	std::vector<int> input = {1, 2, 1, 3, 1};
+	size_t removedCnt = CXXIter::from(input).removeInPlace(1);
+	ASSERT_EQ(removedCnt, 3);
+	ASSERT_THAT(input, ElementsAre(2, 3));
+}
+
+TEST(CXXIter, dedupInPlace) {
+	{ // default comparison
+		std::vector<int> input = {1, 1, 2, 3, 3, 3, 1};
+		size_t removedCnt = CXXIter::from(input).dedupInPlace();
+		ASSERT_EQ(removedCnt, 3);
+		ASSERT_THAT(input, ElementsAre(1, 2, 3, 1));
+	}
+	{ // custom comparer
+		std::vector<std::string> input = {"a", "A", "b", "c", "C", "c"};
+		size_t removedCnt = CXXIter::from(input).dedupInPlace([](const std::string& a, const std::string& b) {
+			return (std::tolower(a[0]) == std::tolower(b[0]));
+		});
+		ASSERT_EQ(removedCnt, 3);
+		ASSERT_THAT(input, ElementsAre("a", "b", "c"));
+	}
+}
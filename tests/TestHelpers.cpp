@@ -1,4 +1,7 @@
+#include <array>
+#include <string>
 #include <vector>
+#include <stdexcept>
 
 #include "TestCommon.h"
 
@@ -91,3 +94,91 @@ TEST(CXXIter, filterIsOneOf) {
 		ASSERT_THAT(output, ElementsAre( CakeType::Sacher, CakeType::Sacher, CakeType::ChocolateCake, CakeType::Sacher ));
 	}
 }
+
+TEST(CXXIter, parse) {
+	std::string input = "1,-22,333";
+	{
+		std::vector<int> output = CXXIter::split(input, ',')
+				.map(CXXIter::fn::parse<int>())
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(1, -22, 333));
+	}
+	{
+		std::vector<double> output = CXXIter::split("0.5;1e3;-2", ';')
+				.map(CXXIter::fn::parse<double>())
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(0.5, 1000.0, -2.0));
+	}
+	{
+		std::vector<std::string> strInput = {"12", "34"};
+		std::vector<uint8_t> output = CXXIter::from(strInput)
+				.map(CXXIter::fn::parse<uint8_t>())
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(12, 34));
+	}
+	ASSERT_THROW(CXXIter::fn::parse<int>()(std::string_view("12a")), std::invalid_argument);
+	ASSERT_THROW(CXXIter::fn::parse<int>()(std::string_view(" 12")), std::invalid_argument);
+	ASSERT_THROW(CXXIter::fn::parse<int>()(std::string_view("")), std::invalid_argument);
+	ASSERT_THROW(CXXIter::fn::parse<uint8_t>()(std::string_view("256")), std::out_of_range);
+}
+
+TEST(CXXIter, tryParse) {
+	std::vector<int> output = CXXIter::split("1,x,333,,4 ,99999999999,-5", ',')
+			.filterMap(CXXIter::fn::tryParse<int>())
+			.collect<std::vector>();
+	ASSERT_THAT(output, ElementsAre(1, 333, -5));
+}
+
+TEST(CXXIter, parseFixedWidth) {
+	{
+		std::vector<uint32_t> output = CXXIter::split("20240131,20231224,00000000,99999999", ',')
+				.map(CXXIter::fn::parseFixedWidth<uint32_t, 8>())
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(20240131, 20231224, 0, 99999999));
+	}
+	{
+		std::vector<int> output = CXXIter::split("0,7,9", ',')
+				.map(CXXIter::fn::parseFixedWidth<int, 1>())
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(0, 7, 9));
+	}
+	{
+		std::vector<uint64_t> output = CXXIter::split("0123456789,4294967296", ',')
+				.map(CXXIter::fn::parseFixedWidth<uint64_t, 10>())
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(123456789ull, 4294967296ull));
+	}
+	auto parse16 = CXXIter::fn::parseFixedWidth<uint64_t, 16>();
+	ASSERT_EQ(parse16(std::string_view("1234567890123456")), 1234567890123456ull);
+	auto parse19 = CXXIter::fn::parseFixedWidth<uint64_t, 19>();
+	ASSERT_EQ(parse19(std::string_view("9999999999999999999")), 9999999999999999999ull);
+	auto parseDate = CXXIter::fn::parseFixedWidth<uint32_t, 8>();
+	ASSERT_THROW(parseDate(std::string_view("2024013")), std::invalid_argument);
+	ASSERT_THROW(parseDate(std::string_view("2024-131")), std::invalid_argument);
+	ASSERT_THROW(parseDate(std::string_view("2024/131")), std::invalid_argument);
+	ASSERT_THROW(parseDate(std::string_view("2024:131")), std::invalid_argument);
+	auto parseByte = CXXIter::fn::parseFixedWidth<uint8_t, 3>();
+	ASSERT_THROW(parseByte(std::string_view("256")), std::invalid_argument);
+}
+
+TEST(CXXIter, parseChunk) {
+	{
+		std::vector<std::array<int, 3>> output = CXXIter::split("1,2,3,4,5,6,7", ',')
+				.chunkedExact<3>()
+				.map(CXXIter::fn::parseChunk<int>())
+				.collect<std::vector>();
+		ASSERT_EQ(output.size(), 2);
+		ASSERT_THAT(output[0], ElementsAre(1, 2, 3));
+		ASSERT_THAT(output[1], ElementsAre(4, 5, 6));
+	}
+	{
+		std::vector<std::string> input = {"20240131", "20231224", "19991231", "20000101"};
+		std::vector<std::array<uint32_t, 2>> output = CXXIter::from(input)
+				.chunkedExact<2>()
+				.map(CXXIter::fn::parseChunk<uint32_t, 8>())
+				.collect<std::vector>();
+		ASSERT_EQ(output.size(), 2);
+		ASSERT_THAT(output[0], ElementsAre(20240131, 20231224));
+		ASSERT_THAT(output[1], ElementsAre(19991231, 20000101));
+	}
+}
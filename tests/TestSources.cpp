@@ -2,16 +2,30 @@
 #include <vector>
 #include <functional>
 #include <string>
+#include <string_view>
+#include <span>
+#include <memory>
 #include <optional>
 #include <set>
 #include <map>
 #include <list>
 #include <deque>
+#include <bitset>
 #include <unordered_set>
 #include <unordered_map>
+#include <thread>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <random>
 
 #include "TestCommon.h"
 
+#ifdef CXXITER_HAS_POSIX_IO
+#include <unistd.h>
+#endif
+
 // ################################################################################################
 // SOURCES
 // ################################################################################################
@@ -260,6 +274,435 @@ TEST(CXXIter, srcRef) { // mutable references (move out of heapTest)
 	}
 }
 
+TEST(CXXIter, srcView) {
+	{ // mutable span
+		std::vector<int> input = {1, 2, 3, 4, 5};
+		std::span<int> view(input);
+		auto iter = CXXIter::from(view);
+		static_assert(std::is_same_v<decltype(iter), CXXIter::SrcView<int>>);
+		static_assert(CXXIter::CXXIterContiguousMemoryIterator<decltype(iter)>);
+		static_assert(CXXIter::CXXIterDoubleEndedIterator<decltype(iter)>);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 5);
+		iter.advanceBy(1);
+		ASSERT_EQ(iter.nextBack().value(), 5);
+		std::move(iter).forEach([](int& item) { item *= 10; });
+		ASSERT_THAT(input, ElementsAre(1, 20, 30, 40, 5));
+		ASSERT_EQ(CXXIter::from(std::span<const int>(input)).skip(10).count(), 0);
+	}
+	{ // string_view
+		std::string_view input = "Hello";
+		auto iter = CXXIter::from(input);
+		static_assert(std::is_same_v<decltype(iter), CXXIter::SrcView<const char>>);
+		std::string output = std::move(iter).reverse().collect<std::basic_string>();
+		ASSERT_EQ(output, "olleH");
+	}
+	{ // C arrays
+		int input[] = {1, 2, 3};
+		ASSERT_EQ(CXXIter::from(input).sum(), 6);
+		const float constInput[] = {0.5f, 1.5f};
+		std::vector<float> output = CXXIter::from(constInput).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(0.5f, 1.5f));
+	}
+	{ // pointer + length
+		std::unique_ptr<float[]> input(new float[3] {1.0f, 2.0f, 3.0f});
+		std::vector<float> output = CXXIter::from(input.get(), 3)
+				.map([](float item) { return item * 2; })
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(2.0f, 4.0f, 6.0f));
+		ASSERT_EQ(CXXIter::from(input.get(), 0).count(), 0);
+	}
+}
+
+#ifdef CXXITER_HAS_MMAP
+TEST(CXXIter, fromMappedFile) {
+	struct Record { uint32_t id; float value; };
+	// unique name, such that concurrent test runs on the same host do not collide
+	std::random_device random;
+	const std::string fileName = "CXXIterTestMappedFile-" + std::to_string(random()) + "-" + std::to_string(random()) + ".bin";
+	const std::filesystem::path path = std::filesystem::temp_directory_path() / fileName;
+	{ // write test file with 4 records and 3 trailing bytes
+		std::vector<Record> records = {{1, 1.5f}, {2, 2.5f}, {3, 3.5f}, {4, 4.5f}};
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+		file.write("xyz", 3);
+	}
+
+	{ // sizeHint & size
+		auto src = CXXIter::fromMappedFile<Record>(path);
+		ASSERT_EQ(src.size(), 4);
+		ASSERT_EQ(src.sizeHint().lowerBound, 4);
+		ASSERT_EQ(src.sizeHint().upperBound.value(), 4);
+		src.next();
+		ASSERT_EQ(src.size(), 3);
+	}
+	{ // forward & backward
+		auto src = CXXIter::fromMappedFile<Record>(path, CXXIter::MappedFileAdvice::RANDOM);
+		ASSERT_EQ(src.next().value().id, 1);
+		ASSERT_EQ(src.nextBack().value().id, 4);
+		src.advanceBy(1);
+		ASSERT_EQ(src.next().value().value, 3.5f);
+		ASSERT_FALSE(src.next().has_value());
+		ASSERT_FALSE(src.nextBack().has_value());
+	}
+	{ // chained, contiguous fast-paths
+		std::vector<uint32_t> output = CXXIter::fromMappedFile<Record>(path)
+				.chunkedExact<2>()
+				.map([](const auto& chunk) { return chunk[0].id + chunk[1].id; })
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(3, 7));
+	}
+	{ // empty file
+		std::ofstream(path, std::ios::binary | std::ios::trunc);
+		auto src = CXXIter::fromMappedFile<Record>(path);
+		ASSERT_EQ(src.size(), 0);
+		ASSERT_FALSE(src.next().has_value());
+	}
+	std::filesystem::remove(path);
+
+	{ // non-existing file
+		ASSERT_THROW(CXXIter::fromMappedFile<Record>(path), std::system_error);
+	}
+}
+#endif
+
+TEST(CXXIter, split) {
+	{ // sizeHint
+		std::string input = "a,bc,,d";
+		auto src = CXXIter::split(input, ',');
+		ASSERT_EQ(src.sizeHint().lowerBound, 4);
+		ASSERT_EQ(src.sizeHint().upperBound.value(), 4);
+		src.next();
+		ASSERT_EQ(src.sizeHint().lowerBound, 3);
+	}
+	{ // views into the input
+		std::string input = "a,bc,,d";
+		std::vector<std::string_view> output = CXXIter::split(input, ',').collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("a", "bc", "", "d"));
+		ASSERT_EQ(output[1].data(), input.data() + 2);
+	}
+	{ // edge cases
+		ASSERT_THAT(CXXIter::split("", ',').collect<std::vector>(), ElementsAre(""));
+		ASSERT_THAT(CXXIter::split(std::string_view(), ',').collect<std::vector>(), ElementsAre(""));
+		ASSERT_THAT(CXXIter::split("a,", ',').collect<std::vector>(), ElementsAre("a", ""));
+		ASSERT_THAT(CXXIter::split(",", ',').collect<std::vector>(), ElementsAre("", ""));
+		ASSERT_THAT(CXXIter::split("abc", ',').collect<std::vector>(), ElementsAre("abc"));
+	}
+}
+
+TEST(CXXIter, lines) {
+	{ // sizeHint
+		auto src = CXXIter::lines("first\r\nsecond\n\nfourth");
+		ASSERT_EQ(src.sizeHint().lowerBound, 4);
+		ASSERT_EQ(src.sizeHint().upperBound.value(), 4);
+		ASSERT_EQ(CXXIter::lines("first\nsecond\n").sizeHint().upperBound.value(), 2);
+		ASSERT_EQ(CXXIter::lines("").sizeHint().upperBound.value(), 0);
+	}
+	{ // line-break variants
+		std::string input = "first\r\nsecond\n\nfourth\n";
+		std::vector<std::string_view> output = CXXIter::lines(input).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("first", "second", "", "fourth"));
+	}
+	{ // edge cases
+		ASSERT_EQ(CXXIter::lines("").count(), 0);
+		ASSERT_THAT(CXXIter::lines("\n").collect<std::vector>(), ElementsAre(""));
+		ASSERT_THAT(CXXIter::lines("abc").collect<std::vector>(), ElementsAre("abc"));
+		ASSERT_THAT(CXXIter::lines("\r\n\r\n").collect<std::vector>(), ElementsAre("", ""));
+	}
+	{ // chained
+		size_t errorCnt = CXXIter::lines("INFO a\nERROR b\nERROR c\nINFO d")
+			.filter([](std::string_view line) { return line.starts_with("ERROR"); })
+			.count();
+		ASSERT_EQ(errorCnt, 2);
+	}
+}
+
+TEST(CXXIter, fromCsv) {
+	{ // simple
+		std::string input = "a,b,c\r\n1,2,3\n,,\n4,5";
+		std::vector<std::vector<std::string_view>> output = CXXIter::fromCsv(input)
+			.map([](const CXXIter::CsvRecord& record) { return std::vector<std::string_view>(record.begin(), record.end()); })
+			.collect<std::vector>();
+		ASSERT_EQ(output.size(), 4);
+		ASSERT_THAT(output[0], ElementsAre("a", "b", "c"));
+		ASSERT_THAT(output[1], ElementsAre("1", "2", "3"));
+		ASSERT_THAT(output[2], ElementsAre("", "", ""));
+		ASSERT_THAT(output[3], ElementsAre("4", "5"));
+		ASSERT_EQ(output[1][0].data(), input.data() + 7);
+	}
+	{ // quoted fields
+		std::string input = "\"x,y\",\"multi\nline\",\"say \"\"hi\"\"\"\r\nplain,\"\",end\n";
+		auto src = CXXIter::fromCsv(input);
+		const CXXIter::CsvRecord& first = src.next().value();
+		ASSERT_EQ(first.size(), 3);
+		ASSERT_EQ(first[0], "x,y");
+		ASSERT_EQ(first[1], "multi\nline");
+		ASSERT_EQ(first[2], "say \"\"hi\"\"");
+		ASSERT_EQ(CXXIter::CsvRecord::unescape(first[2]), "say \"hi\"");
+		const CXXIter::CsvRecord& second = src.next().value();
+		ASSERT_EQ(second.size(), 3);
+		ASSERT_EQ(second[0], "plain");
+		ASSERT_EQ(second[1], "");
+		ASSERT_EQ(second[2], "end");
+		ASSERT_FALSE(src.next().has_value());
+	}
+	{ // header, projection & composition
+		std::string input = "name,team,score\nalice,red,3\nbob,blue,5\ncarol,red,4\n";
+		auto output = CXXIter::fromCsvColumns(input, {1, 2}, {.skipHeader = true})
+			.groupBy([](const CXXIter::CsvRecord& record) { return std::string(record[0]); })
+			.map([](const auto& group) {
+				return std::make_pair(group.first, CXXIter::from(group.second)
+					.map([](const CXXIter::CsvRecord& record) { return std::stoi(std::string(record[1])); })
+					.sum());
+			})
+			.collect<std::map>();
+		ASSERT_EQ(output.size(), 2);
+		ASSERT_EQ(output["red"], 7);
+		ASSERT_EQ(output["blue"], 5);
+	}
+	{ // projection of missing columns, tsv
+		std::string input = "a\tb\tc\nd\n";
+		std::vector<std::string> output = CXXIter::fromTsvColumns(input, {2, 0})
+			.map([](const CXXIter::CsvRecord& record) { return std::string(record[0]) + "|" + std::string(record[1]); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("c|a", "|d"));
+	}
+	{ // tsv with options keeps the tabulator as separator
+		std::string input = "h1\th2\na\tb,c\n";
+		auto src = CXXIter::fromTsv(input, {.skipHeader = true});
+		const CXXIter::CsvRecord& record = src.next().value();
+		ASSERT_EQ(record.size(), 2);
+		ASSERT_EQ(record[0], "a");
+		ASSERT_EQ(record[1], "b,c");
+		std::vector<std::string> output = CXXIter::fromTsvColumns(input, {1}, {.separator = ',', .skipHeader = true})
+			.map([](const CXXIter::CsvRecord& record) { return std::string(record[0]); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("b,c"));
+	}
+	{ // empty input
+		ASSERT_EQ(CXXIter::fromCsv("").count(), 0);
+	}
+}
+
+TEST(CXXIter, linesFrom) {
+	{ // lines straddling blocks, lines larger than a block
+		std::istringstream input("first\r\nsecond\n\na much longer fourth line\nfifth");
+		std::vector<std::string> output = CXXIter::linesFrom(input, 8)
+			.map([](std::string_view line) { return std::string(line); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("first", "second", "", "a much longer fourth line", "fifth"));
+	}
+	{ // trailing line-break, empty stream
+		std::istringstream input("a\nb\n");
+		ASSERT_EQ(CXXIter::linesFrom(input, 3).count(), 2);
+		std::istringstream emptyInput("");
+		ASSERT_EQ(CXXIter::linesFrom(emptyInput).count(), 0);
+	}
+	{ // custom delimiter
+		std::istringstream input("a;bc\r;;d");
+		std::vector<std::string> output = CXXIter::splitFrom(input, ';', 4)
+			.map([](std::string_view record) { return std::string(record); })
+			.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("a", "bc\r", "", "d"));
+	}
+	{ // trailing delimiter and empty stream behave like split()
+		for(std::string content : {"a;", "a;;b", ";", ""}) {
+			std::istringstream input(content);
+			std::vector<std::string> output = CXXIter::splitFrom(input, ';', 2).collect<std::vector>();
+			std::vector<std::string> expected = CXXIter::split(content, ';')
+				.map([](std::string_view part) { return std::string(part); })
+				.collect<std::vector>();
+			ASSERT_EQ(output, expected) << content;
+		}
+	}
+	{ // records are yielded as owned strings, so they stay valid across refills of small blocks
+		std::string content;
+		for(size_t i = 0; i < 500; ++i) { content += "line number " + std::to_string(i) + "\n"; }
+		auto expected = CXXIter::range<size_t>(0, 499)
+			.map([](size_t i) { return "line number " + std::to_string(i); })
+			.collect<std::vector>();
+		std::istringstream input(content);
+		auto iter = CXXIter::linesFrom(input, 16);
+		static_assert(std::is_same_v<decltype(iter)::Item, std::string>);
+		ASSERT_EQ(std::move(iter).buffered(8).collect<std::vector>(), expected);
+		std::istringstream cachedInput(content);
+		ASSERT_EQ(CXXIter::linesFrom(cachedInput, 16).cached().replay().collect<std::vector>(), expected);
+		std::istringstream parInput(content);
+		ASSERT_EQ(CXXIter::linesFrom(parInput, 16).parMap([](std::string line) { return line; }, 4, 8).collect<std::vector>(), expected);
+		std::istringstream teeInput(content);
+		auto [branchA, branchB] = CXXIter::linesFrom(teeInput, 16).tee<2>(1024);
+		ASSERT_EQ(branchA.collect<std::vector>(), expected);
+		ASSERT_EQ(branchB.collect<std::vector>(), expected);
+	}
+#ifdef CXXITER_HAS_POSIX_IO
+	{ // file descriptor
+		int pipeFds[2];
+		ASSERT_EQ(pipe(pipeFds), 0);
+		std::string_view content = "line1\nline2\nline3\n";
+		ASSERT_EQ(write(pipeFds[1], content.data(), content.size()), static_cast<ssize_t>(content.size()));
+		close(pipeFds[1]);
+		std::vector<std::string> output = CXXIter::linesFrom(pipeFds[0], 4)
+			.map([](std::string_view line) { return std::string(line); })
+			.collect<std::vector>();
+		close(pipeFds[0]);
+		ASSERT_THAT(output, ElementsAre("line1", "line2", "line3"));
+	}
+#endif
+}
+
+TEST(CXXIter, recordsFrom) {
+	struct Record { uint32_t id; float value; };
+	std::vector<Record> records;
+	for(uint32_t i = 0; i < 100; ++i) { records.push_back({i, i * 0.5f}); }
+	std::string content(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(Record));
+	content += "xyz"; // trailing incomplete record
+
+	{ // records straddling blocks
+		std::istringstream input(content);
+		std::vector<uint32_t> output = CXXIter::recordsFrom<Record>(input, 20)
+			.map([](const Record& record) { return record.id; })
+			.collect<std::vector>();
+		ASSERT_EQ(output.size(), 100);
+		ASSERT_EQ(output, CXXIter::range<uint32_t>(0, 99).collect<std::vector>());
+	}
+	{ // records are yielded by value, so they can be held across next() calls
+		std::istringstream input(content);
+		auto iter = CXXIter::recordsFrom<Record>(input, sizeof(Record));
+		static_assert(std::is_same_v<decltype(iter)::Item, Record>);
+		std::vector<Record> output = std::move(iter).reverse().collect<std::vector>();
+		ASSERT_EQ(output.size(), 100);
+		ASSERT_EQ(output.front().id, 99);
+		ASSERT_EQ(output.back().id, 0);
+	}
+	{ // block smaller than a record
+		std::istringstream input(content);
+		float sum = CXXIter::recordsFrom<Record>(input, 3)
+			.map([](const Record& record) { return record.value; })
+			.sum();
+		ASSERT_FLOAT_EQ(sum, 2475.0f);
+	}
+}
+
+TEST(CXXIter, fromBits) {
+	{
+		std::vector<uint64_t> input = {0b1010, 0, 0b1 | (1ull << 63), 0};
+		std::vector<size_t> output = CXXIter::fromBits(input)
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(1, 3, 128, 191));
+	}
+	{
+		std::vector<uint64_t> input = {~0ull, 0, 0b110, ~0ull};
+		auto iter = CXXIter::fromBits(input);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 130);
+		ASSERT_EQ(iter.sizeHint().upperBound.value(), 130);
+		iter.advanceBy(63);
+		ASSERT_EQ(iter.next().value(), 63);
+		ASSERT_EQ(iter.next().value(), 129);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 65);
+		iter.advanceBy(2);
+		ASSERT_EQ(iter.next().value(), 193);
+		iter.advanceBy(1000);
+		ASSERT_FALSE(iter.next().has_value());
+		ASSERT_EQ(iter.sizeHint().lowerBound, 0);
+	}
+	{
+		std::vector<uint64_t> input;
+		ASSERT_EQ(CXXIter::fromBits(input).count(), 0);
+		input = {0, 0};
+		ASSERT_EQ(CXXIter::fromBits(input).count(), 0);
+	}
+}
+
+TEST(CXXIter, fromBitset) {
+	{
+		std::bitset<130> input;
+		input.set(0).set(64).set(65).set(129);
+		std::vector<size_t> output = CXXIter::fromBitset(input)
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(0, 64, 65, 129));
+	}
+	{
+		std::bitset<10> input("1000100001");
+		std::vector<size_t> output = CXXIter::fromBitset(input)
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(0, 5, 9));
+	}
+}
+
+TEST(CXXIter, fromVarint) {
+	{
+		std::vector<uint64_t> input = {0, 1, 127, 128, 300, 70000, ~0ull};
+		std::vector<uint8_t> encoded = CXXIter::encodeVarint<uint64_t>(input);
+		ASSERT_EQ(encoded.size(), 1 + 1 + 1 + 2 + 2 + 3 + 10);
+		auto iter = CXXIter::fromVarint(encoded);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 7);
+		std::vector<uint64_t> output = std::move(iter).collect<std::vector>();
+		ASSERT_EQ(output, input);
+	}
+	{
+		std::vector<uint32_t> input = {1, 300, 70000, 5};
+		std::vector<uint8_t> encoded = CXXIter::encodeVarint<uint32_t>(input);
+		auto iter = CXXIter::fromVarint<uint32_t>(encoded);
+		iter.advanceBy(2);
+		ASSERT_EQ(iter.next().value(), 70000);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 1);
+		// truncated last value
+		encoded.back() |= 0x80;
+		std::vector<uint32_t> output = CXXIter::fromVarint<uint32_t>(encoded).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(1, 300, 70000));
+	}
+	{
+		std::vector<uint64_t> input = {1000, 1003, 1010, 1010, 5000000000ull};
+		std::vector<uint8_t> encoded = CXXIter::encodeDeltaVarint<uint64_t>(input);
+		ASSERT_EQ(encoded[2], 0x03);
+		auto iter = CXXIter::fromDeltaVarint(encoded);
+		iter.advanceBy(2);
+		std::vector<uint64_t> output = std::move(iter).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(1010, 1010, 5000000000ull));
+	}
+}
+
+TEST(CXXIter, fromBitPacked) {
+	std::vector<uint32_t> input = CXXIter::range<uint32_t>(0, 999, 1)
+			.map([](uint32_t i) { return (i < 128) ? 0 : (i * 7919) % (i < 512 ? 1000 : 100000000); })
+			.collect<std::vector>();
+	{
+		std::vector<uint8_t> encoded = CXXIter::encodeBitPacked(input);
+		ASSERT_EQ(CXXIter::fromBitPacked(encoded).collect<std::vector>(), input);
+		auto iter = CXXIter::fromBitPacked(encoded);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 1000);
+		iter.advanceBy(3);
+		ASSERT_EQ(iter.next().value(), input[3]);
+		iter.advanceBy(300);
+		ASSERT_EQ(iter.next().value(), input[304]);
+		ASSERT_EQ(iter.sizeHint().lowerBound, 1000 - 305);
+		iter.advanceBy(694);
+		ASSERT_EQ(iter.next().value(), input[999]);
+		ASSERT_FALSE(iter.next().has_value());
+	}
+	{
+		std::vector<uint32_t> sortedInput = input;
+		std::sort(sortedInput.begin(), sortedInput.end());
+		std::vector<uint8_t> encoded = CXXIter::encodeDeltaBitPacked(sortedInput);
+		ASSERT_LT(encoded.size(), CXXIter::encodeBitPacked(sortedInput).size());
+		ASSERT_EQ(CXXIter::fromDeltaBitPacked(encoded).collect<std::vector>(), sortedInput);
+		auto iter = CXXIter::fromDeltaBitPacked(encoded);
+		iter.advanceBy(640);
+		ASSERT_EQ(iter.next().value(), sortedInput[640]);
+		ASSERT_EQ(iter.next().value(), sortedInput[641]);
+		// truncated buffer
+		encoded.resize(encoded.size() - 1);
+		ASSERT_EQ(CXXIter::fromDeltaBitPacked(encoded).size(), 896);
+		ASSERT_EQ(CXXIter::fromDeltaBitPacked(encoded).collect<std::vector>().size(), 896);
+		ASSERT_EQ(CXXIter::fromDeltaBitPacked(encoded).reverse().next().value(), sortedInput[895]);
+	}
+	{
+		std::vector<uint32_t> emptyInput;
+		std::vector<uint8_t> encoded = CXXIter::encodeBitPacked(emptyInput);
+		ASSERT_EQ(CXXIter::fromBitPacked(encoded).count(), 0);
+		ASSERT_EQ(CXXIter::fromBitPacked(std::span<const uint8_t>()).count(), 0);
+	}
+}
+
 TEST(CXXIter, empty) {
 	CXXIter::IterValue<std::string> output = CXXIter::empty<std::string>().next();
 	ASSERT_FALSE(output.has_value());
@@ -300,6 +743,318 @@ TEST(CXXIter, generate) {
 		ASSERT_THAT(output, ElementsAre("0"));
 	}
 }
+
+template<typename T>
+struct CountingAllocator {
+	using value_type = T;
+	size_t* allocCnt;
+	size_t* deallocCnt;
+
+	CountingAllocator(size_t* allocCnt, size_t* deallocCnt) : allocCnt(allocCnt), deallocCnt(deallocCnt) {}
+	template<typename U>
+	CountingAllocator(const CountingAllocator<U>& o) : allocCnt(o.allocCnt), deallocCnt(o.deallocCnt) {}
+
+	T* allocate(size_t n) { *allocCnt += 1; return std::allocator<T>().allocate(n); }
+	void deallocate(T* ptr, size_t n) { *deallocCnt += 1; std::allocator<T>().deallocate(ptr, n); }
+};
+
+TEST(CXXIter, generatorFrameAllocation) {
+	{ // frames are reused from the thread-local pool
+		void* frame = CXXIter::util::CoroutineFramePool::allocate(100);
+		CXXIter::util::CoroutineFramePool::deallocate(frame, 100);
+		void* reusedFrame = CXXIter::util::CoroutineFramePool::allocate(90);
+		ASSERT_EQ(frame, reusedFrame);
+		CXXIter::util::CoroutineFramePool::deallocate(reusedFrame, 90);
+	}
+	{ // frames freed by thread-local destructors after the pool of the thread was destroyed
+		struct GeneratorHolder {
+			CXXIter::Generator<int> generator;
+			~GeneratorHolder() { generator = {}; }
+		};
+		std::thread thread([]() {
+			// constructed before the pool, and thus destroyed after it
+			thread_local GeneratorHolder holder;
+			holder.generator = []() -> CXXIter::Generator<int> { co_yield 1; }();
+			ASSERT_EQ(holder.generator.next().value(), 1);
+		});
+		thread.join();
+	}
+	{ // many short-lived pooled generators
+		size_t output = CXXIter::range<size_t>(0, 9999)
+				.generateFrom([](size_t item) -> CXXIter::Generator<size_t> {
+					co_yield item;
+					co_yield item;
+				})
+				.sum();
+		ASSERT_EQ(output, 2 * 49995000);
+	}
+	{ // user-supplied allocator
+		size_t allocCnt = 0, deallocCnt = 0;
+		CountingAllocator<std::byte> alloc(&allocCnt, &deallocCnt);
+		{
+			CXXIter::GeneratorAllocatorScope scope(alloc);
+			std::vector<size_t> output = CXXIter::range<size_t>(0, 2)
+					.generateFrom([](size_t item) -> CXXIter::Generator<size_t> {
+						co_yield item;
+						co_yield item * 10;
+					})
+					.collect<std::vector>();
+			ASSERT_THAT(output, ElementsAre(0, 0, 1, 10, 2, 20));
+		}
+		ASSERT_EQ(allocCnt, 3);
+		ASSERT_EQ(deallocCnt, 3);
+		// frames created outside of the scope use the pool again
+		CXXIter::generate([]() -> CXXIter::Generator<int> { co_yield 1; }).count();
+		ASSERT_EQ(allocCnt, 3);
+	}
+}
+
+TEST(CXXIter, generatorYield) {
+	struct CopyCounter {
+		size_t* copyCnt;
+		CopyCounter(size_t* copyCnt) : copyCnt(copyCnt) {}
+		CopyCounter(const CopyCounter& o) : copyCnt(o.copyCnt) { *copyCnt += 1; }
+		CopyCounter(CopyCounter&& o) noexcept = default;
+		CopyCounter& operator=(const CopyCounter& o) { copyCnt = o.copyCnt; *copyCnt += 1; return *this; }
+		CopyCounter& operator=(CopyCounter&& o) noexcept = default;
+	};
+	{ // rvalues are moved, lvalues are copied exactly once
+		auto yieldCopyCounters = [](size_t* copyCnt) -> CXXIter::Generator<CopyCounter> {
+			CopyCounter lvalue(copyCnt);
+			co_yield lvalue;
+			co_yield CopyCounter(copyCnt);
+			co_yield copyCnt; // converting yield
+		};
+		size_t copyCnt = 0;
+		size_t output = CXXIter::generate([&]() { return yieldCopyCounters(&copyCnt); }).count();
+		ASSERT_EQ(output, 3);
+		ASSERT_EQ(copyCnt, 1);
+	}
+	{ // move-only items
+		std::vector<std::unique_ptr<int>> output = CXXIter::generate([]() -> CXXIter::Generator<std::unique_ptr<int>> {
+			for(int i = 0; i < 3; ++i) {
+				std::unique_ptr<int> item = std::make_unique<int>(i);
+				co_yield std::move(item);
+			}
+			co_yield std::make_unique<int>(3);
+		}).collect<std::vector>();
+		ASSERT_EQ(output.size(), 4);
+		for(size_t i = 0; i < output.size(); ++i) {
+			ASSERT_EQ(*output[i], static_cast<int>(i));
+		}
+	}
+	{ // references are passed through without copying
+		std::vector<std::string> input = {"a", "b"};
+		auto yieldRefs = [](const std::vector<std::string>& input) -> CXXIter::Generator<const std::string&> {
+			for(const std::string& item : input) { co_yield item; }
+		};
+		std::vector<const std::string*> output = CXXIter::generate([&]() { return yieldRefs(input); }).map([](const std::string& item) { return &item; }).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(&input[0], &input[1]));
+	}
+	{ // move-assignment destroys the previous coroutine
+		auto makeGenerator = [](int n) -> CXXIter::Generator<int> { co_yield n; };
+		CXXIter::Generator<int> generator = makeGenerator(1);
+		generator = makeGenerator(2);
+		ASSERT_EQ(generator.next().value(), 2);
+		ASSERT_FALSE(generator.next().has_value());
+		ASSERT_FALSE(generator.next().has_value());
+	}
+}
+
+struct GeneratorTestNode {
+	int value;
+	std::vector<GeneratorTestNode> children;
+};
+static CXXIter::Generator<int> walkGeneratorTestNode(const GeneratorTestNode& node) {
+	co_yield node.value;
+	for(const GeneratorTestNode& child : node.children) {
+		co_yield CXXIter::elementsOf(walkGeneratorTestNode(child));
+	}
+}
+static CXXIter::Generator<int> countDownThrowing(int n) {
+	if(n == 0) { throw std::runtime_error("bottom"); }
+	co_yield n;
+	co_yield CXXIter::elementsOf(countDownThrowing(n - 1));
+}
+
+TEST(CXXIter, generatorElementsOf) {
+	{ // tree walk
+		GeneratorTestNode root = {1, {{2, {{3, {}}, {4, {}}}}, {5, {}}, {6, {{7, {}}}}}};
+		std::vector<int> output = CXXIter::generate([&]() { return walkGeneratorTestNode(root); }).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(1, 2, 3, 4, 5, 6, 7));
+	}
+	{ // deep nesting
+		GeneratorTestNode root = {0, {}};
+		GeneratorTestNode* node = &root;
+		for(int i = 1; i < 100; ++i) {
+			node->children.push_back({i, {}});
+			node = &node->children.back();
+		}
+		size_t output = CXXIter::generate([&]() { return walkGeneratorTestNode(root); }).sum();
+		ASSERT_EQ(output, 4950);
+	}
+	{ // empty children and early destruction
+		auto makeEmpty = []() -> CXXIter::Generator<std::string> { co_return; };
+		auto makeGenerator = [makeEmpty]() -> CXXIter::Generator<std::string> {
+			co_yield CXXIter::elementsOf(makeEmpty());
+			co_yield std::string("a");
+			co_yield CXXIter::elementsOf(makeEmpty());
+			co_yield std::string("b");
+		};
+		CXXIter::Generator<std::string> generator = makeGenerator();
+		ASSERT_EQ(generator.next().value(), "a");
+	}
+	{ // exceptions propagate through all levels
+		CXXIter::Generator<int> generator = countDownThrowing(3);
+		ASSERT_EQ(generator.next().value(), 3);
+		ASSERT_EQ(generator.next().value(), 2);
+		ASSERT_EQ(generator.next().value(), 1);
+		ASSERT_THROW(generator.next(), std::runtime_error);
+	}
+}
+
+static CXXIter::Generator<const int&> yieldBlocks(size_t* resumeCnt, int blockCnt) {
+	std::vector<int> block;
+	for(int i = 0; i < blockCnt; ++i) {
+		block.clear();
+		for(int j = 0; j < i; ++j) { block.push_back(i * 10 + j); }
+		*resumeCnt += 1;
+		co_yield CXXIter::elementsOf(block);
+	}
+	int last = 42;
+	co_yield last;
+}
+
+template<typename TGenerator, typename TElement>
+concept CanYieldSpanOf = requires(typename TGenerator::promise_type& promise, std::span<TElement> items) {
+	promise.yield_value(CXXIter::elementsOf(items));
+};
+
+TEST(CXXIter, generatorElementsOfSpan) {
+	{ // batch items are never moved out of the span, so move-only values can not be yielded as batch
+		static_assert(CanYieldSpanOf<CXXIter::Generator<std::string>, std::string>);
+		static_assert(CanYieldSpanOf<CXXIter::Generator<std::string>, const std::string>);
+		static_assert(!CanYieldSpanOf<CXXIter::Generator<std::unique_ptr<int>>, std::unique_ptr<int>>);
+		static_assert(!CanYieldSpanOf<CXXIter::Generator<std::unique_ptr<int>>, const std::unique_ptr<int>>);
+		static_assert(CanYieldSpanOf<CXXIter::Generator<const std::unique_ptr<int>&>, std::unique_ptr<int>>);
+	}
+	{ // generator of values copies the items out of the batch
+		auto makeGenerator = []() -> CXXIter::Generator<std::string> {
+			std::vector<std::string> block = {"a", "b", "c"};
+			co_yield CXXIter::elementsOf(block);
+			co_yield CXXIter::elementsOf(std::span(block).subspan(1));
+			co_yield std::string("d");
+		};
+		std::vector<std::string> output = CXXIter::generate(makeGenerator).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("a", "b", "c", "b", "c", "d"));
+	}
+	{ // item-wise iteration only resumes once per block
+		size_t resumeCnt = 0;
+		std::vector<int> output = CXXIter::generate([&]() { return yieldBlocks(&resumeCnt, 4); })
+				.map([](const int& item) { return item; })
+				.collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre(10, 20, 21, 30, 31, 32, 42));
+		ASSERT_EQ(resumeCnt, 4);
+	}
+	{ // batches
+		size_t resumeCnt = 0;
+		CXXIter::Generator<const int&> generator = yieldBlocks(&resumeCnt, 4);
+		ASSERT_EQ(generator.next().value(), 10); // block 1 (block 0 is empty)
+		ASSERT_EQ(generator.nextBatch().size(), 2); // block 2
+		ASSERT_EQ(generator.next().value(), 30);
+		std::span<const int> batch = generator.nextBatch();
+		ASSERT_THAT(std::vector<int>(batch.begin(), batch.end()), ElementsAre(31, 32));
+		batch = generator.nextBatch();
+		ASSERT_THAT(std::vector<int>(batch.begin(), batch.end()), ElementsAre(42));
+		ASSERT_TRUE(generator.nextBatch().empty());
+		ASSERT_FALSE(generator.next().has_value());
+	}
+	{ // segmented consumption of reference generators
+		size_t resumeCnt = 0;
+		auto iter = CXXIter::generate([&]() { return yieldBlocks(&resumeCnt, 100); });
+		static_assert(CXXIter::CXXIterSegmentedIterator<decltype(iter)>);
+		int output = iter.sum();
+		int expected = 42;
+		for(int i = 0; i < 100; ++i) {
+			for(int j = 0; j < i; ++j) { expected += i * 10 + j; }
+		}
+		ASSERT_EQ(output, expected);
+	}
+}
+
+static CXXIter::AsyncGenerator<std::string> asyncProduce(CXXIter::EventLoop& loop, std::string name, int cnt, std::vector<std::string>* log) {
+	for(int i = 0; i < cnt; ++i) {
+		co_await loop.yield(); // simulates waiting for I/O
+		log->push_back(name + std::to_string(i));
+		co_yield name + std::to_string(i);
+	}
+}
+static CXXIter::Task<size_t> asyncConsume(CXXIter::AsyncGenerator<std::string> input) {
+	size_t totalLength = 0;
+	co_await input.forEachAsync([&](const std::string& item) { totalLength += item.size(); });
+	co_return totalLength;
+}
+static CXXIter::AsyncGenerator<int> asyncThrowing() {
+	co_yield 1;
+	throw std::runtime_error("failed");
+}
+
+TEST(CXXIter, asyncGenerator) {
+	{ // collect
+		CXXIter::EventLoop loop;
+		std::vector<std::string> log;
+		auto consume = [](CXXIter::AsyncGenerator<std::string> input) -> CXXIter::Task<std::vector<std::string>> {
+			co_return co_await input.collectAsync();
+		};
+		std::vector<std::string> output = loop.runUntilComplete(consume(asyncProduce(loop, "a", 3, &log)));
+		ASSERT_THAT(output, ElementsAre("a0", "a1", "a2"));
+	}
+	{ // many pipelines are interleaved on a single thread
+		CXXIter::EventLoop loop;
+		std::vector<std::string> log;
+		auto consume = [](CXXIter::AsyncGenerator<std::string> input, size_t* output) -> CXXIter::Task<> {
+			*output = co_await asyncConsume(std::move(input));
+		};
+		size_t outputA = 0, outputB = 0;
+		loop.spawn(consume(asyncProduce(loop, "a", 3, &log), &outputA));
+		loop.spawn(consume(asyncProduce(loop, "bb", 2, &log), &outputB));
+		loop.run();
+		ASSERT_EQ(outputA, 6);
+		ASSERT_EQ(outputB, 6);
+		ASSERT_THAT(log, ElementsAre("a0", "bb0", "a1", "bb1", "a2"));
+	}
+	{ // timers
+		CXXIter::EventLoop loop;
+		auto sleepy = [](CXXIter::EventLoop& loop) -> CXXIter::AsyncGenerator<int> {
+			for(int i = 0; i < 3; ++i) {
+				co_await loop.sleepFor(std::chrono::milliseconds(1));
+				co_yield i;
+			}
+		};
+		auto consume = [](CXXIter::AsyncGenerator<int> input) -> CXXIter::Task<std::vector<int>> {
+			co_return co_await input.collectAsync();
+		};
+		ASSERT_THAT(loop.runUntilComplete(consume(sleepy(loop))), ElementsAre(0, 1, 2));
+	}
+	{ // exceptions propagate to the consumer
+		CXXIter::EventLoop loop;
+		auto consume = [](CXXIter::AsyncGenerator<int> input) -> CXXIter::Task<std::vector<int>> {
+			co_return co_await input.collectAsync();
+		};
+		ASSERT_THROW(loop.runUntilComplete(consume(asyncThrowing())), std::runtime_error);
+	}
+	{ // synchronous pipeline into an asynchronous sink
+		CXXIter::EventLoop loop;
+		std::vector<int> output;
+		auto sink = [](CXXIter::EventLoop& loop, std::vector<int>& output, int item) -> CXXIter::Task<> {
+			co_await loop.yield();
+			output.push_back(item);
+		};
+		auto iter = CXXIter::range(1, 4).map([](int item) { return item * 2; });
+		loop.runUntilComplete(iter.forEachAsync([&](int item) { return sink(loop, output, item); }));
+		ASSERT_THAT(output, ElementsAre(2, 4, 6, 8));
+	}
+}
 #endif
 
 TEST(CXXIter, repeat) {
@@ -358,6 +1113,68 @@ TEST(CXXIter, range) {
 	}
 }
 
+TEST(CXXIter, channel) {
+	{ // close semantics
+		CXXIter::Channel<std::string> channel(3);
+		ASSERT_EQ(channel.capacity(), 4);
+		ASSERT_FALSE(channel.tryReceive().has_value());
+		std::vector<std::string> input = {"1337", "42", "64", "128", "256"};
+		ASSERT_EQ(CXXIter::from(input).take(4).sendTo(channel), 4);
+		ASSERT_FALSE(channel.trySend("256"));
+		channel.close();
+		ASSERT_TRUE(channel.isClosed());
+		ASSERT_FALSE(channel.send("256"));
+		ASSERT_EQ(CXXIter::from(input).sendTo(channel), 0);
+		auto output = CXXIter::fromChannel(channel).collect<std::vector>();
+		ASSERT_THAT(output, ElementsAre("1337", "42", "64", "128"));
+		ASSERT_FALSE(channel.receive().has_value());
+	}
+	{ // remaining elements are destroyed with the channel
+		std::shared_ptr<int> item = std::make_shared<int>(42);
+		{
+			CXXIter::Channel<std::shared_ptr<int>> channel(8);
+			ASSERT_TRUE(channel.trySend(item));
+			ASSERT_EQ(item.use_count(), 2);
+		}
+		ASSERT_EQ(item.use_count(), 1);
+	}
+	{ // fan-in: multiple producers into one pipeline
+		static constexpr size_t PRODUCER_CNT = 4;
+		static constexpr size_t ITEM_CNT = 10000;
+		CXXIter::Channel<size_t> channel(16);
+		std::vector<std::thread> producers;
+		for(size_t i = 0; i < PRODUCER_CNT; ++i) {
+			producers.emplace_back([&channel, i]() {
+				CXXIter::range<size_t>(0, ITEM_CNT - 1).map([i](size_t j) { return i * ITEM_CNT + j; }).sendTo(channel);
+			});
+		}
+		std::thread closer([&]() {
+			for(std::thread& producer : producers) { producer.join(); }
+			channel.close();
+		});
+		std::vector<size_t> output = CXXIter::fromChannel(channel).collect<std::vector>();
+		closer.join();
+		std::sort(output.begin(), output.end());
+		ASSERT_EQ(output.size(), PRODUCER_CNT * ITEM_CNT);
+		ASSERT_EQ(output, CXXIter::range<size_t>(0, PRODUCER_CNT * ITEM_CNT - 1).collect<std::vector>());
+	}
+	{ // fan-out: one pipeline into multiple consumers
+		static constexpr size_t CONSUMER_CNT = 3;
+		CXXIter::Channel<size_t> channel(8);
+		std::vector<size_t> sums(CONSUMER_CNT, 0);
+		std::vector<std::thread> consumers;
+		for(size_t i = 0; i < CONSUMER_CNT; ++i) {
+			consumers.emplace_back([&channel, &sums, i]() {
+				sums[i] = CXXIter::fromChannel(channel).sum();
+			});
+		}
+		ASSERT_EQ(CXXIter::range<size_t>(1, 10000).sendTo(channel), 10000);
+		channel.close();
+		for(std::thread& consumer : consumers) { consumer.join(); }
+		ASSERT_EQ(CXXIter::from(sums).sum(), 50005000);
+	}
+}
+
 TEST(CXXIter, next) {
 	std::vector<std::string> input = {"42", "1337"};
 	auto iter = CXXIter::from(input);